@@ -95,84 +95,78 @@ namespace vk
 		"  class Flags\n"
 		"  {\n"
 		"  public:\n"
-		"    Flags()\n"
+		"    VK_CPP_CONSTEXPR Flags()\n"
 		"      : m_mask( 0 )\n"
 		"    {}\n"
 		"\n"
-		"    Flags( BitType bit )\n"
+		"    VK_CPP_CONSTEXPR Flags( BitType bit )\n"
 		"      : m_mask( static_cast<uint32_t>( bit ) )\n"
 		"    {}\n"
 		"\n"
-		"    Flags( Flags<BitType> const& rhs )\n"
-		"      : m_mask( rhs.m_mask )\n"
-		"    {}\n"
+		"    Flags( Flags const& rhs ) = default;\n"
 		"\n"
-		"    Flags<BitType>& operator=( Flags<BitType> const& rhs )\n"
-		"    {\n"
-		"      m_mask = rhs.m_mask;\n"
-		"      return *this;\n"
-		"    }\n"
+		"    Flags& operator=( Flags const& rhs ) = default;\n"
 		"\n"
-		"    Flags<BitType>& operator|=( Flags<BitType> const& rhs )\n"
+		"    VK_CPP_CONSTEXPR Flags<BitType>& operator|=( Flags<BitType> const& rhs )\n"
 		"    {\n"
 		"      m_mask |= rhs.m_mask;\n"
 		"      return *this;\n"
 		"    }\n"
 		"\n"
-		"    Flags<BitType>& operator&=( Flags<BitType> const& rhs )\n"
+		"    VK_CPP_CONSTEXPR Flags<BitType>& operator&=( Flags<BitType> const& rhs )\n"
 		"    {\n"
 		"      m_mask &= rhs.m_mask;\n"
 		"      return *this;\n"
 		"    }\n"
 		"\n"
-		"    Flags<BitType>& operator^=( Flags<BitType> const& rhs )\n"
+		"    VK_CPP_CONSTEXPR Flags<BitType>& operator^=( Flags<BitType> const& rhs )\n"
 		"    {\n"
 		"      m_mask ^= rhs.m_mask;\n"
 		"      return *this;\n"
 		"    }\n"
 		"\n"
-		"    Flags<BitType> operator|( Flags<BitType> const& rhs ) const\n"
+		"    VK_CPP_CONSTEXPR Flags<BitType> operator|( Flags<BitType> const& rhs ) const\n"
 		"    {\n"
 		"      Flags<BitType> result(*this);\n"
 		"      result |= rhs;\n"
 		"      return result;\n"
 		"    }\n"
 		"\n"
-		"    Flags<BitType> operator&( Flags<BitType> const& rhs ) const\n"
+		"    VK_CPP_CONSTEXPR Flags<BitType> operator&( Flags<BitType> const& rhs ) const\n"
 		"    {\n"
 		"      Flags<BitType> result( *this );\n"
 		"      result &= rhs;\n"
 		"      return result;\n"
 		"    }\n"
 		"\n"
-		"    Flags<BitType> operator^( Flags<BitType> const& rhs ) const\n"
+		"    VK_CPP_CONSTEXPR Flags<BitType> operator^( Flags<BitType> const& rhs ) const\n"
 		"    {\n"
 		"      Flags<BitType> result( *this );\n"
 		"      result ^= rhs;\n"
 		"      return result;\n"
 		"    }\n"
 		"\n"
-		"    bool operator!() const\n"
+		"    VK_CPP_CONSTEXPR bool operator!() const\n"
 		"    {\n"
 		"      return !m_mask;\n"
 		"    }\n"
 		"\n"
-		"    bool operator==( Flags<BitType> const& rhs ) const\n"
+		"    VK_CPP_CONSTEXPR bool operator==( Flags<BitType> const& rhs ) const\n"
 		"    {\n"
 		"      return m_mask == rhs.m_mask;\n"
 		"    }\n"
 		"\n"
-		"    bool operator!=( Flags<BitType> const& rhs ) const\n"
+		"    VK_CPP_CONSTEXPR bool operator!=( Flags<BitType> const& rhs ) const\n"
 		"    {\n"
 		"      return m_mask != rhs.m_mask;\n"
 		"    }\n"
 		"\n"
-		"    explicit operator bool() const\n"
+		"    VK_CPP_CONSTEXPR explicit operator bool() const\n"
 		"    {\n"
 		"      return !!m_mask;\n"
 		"    }\n"
 		"\n"
-		"    explicit operator MaskType() const\n"
+		"    VK_CPP_CONSTEXPR explicit operator MaskType() const\n"
 		"    {\n"
 		"        return m_mask;\n"
 		"    }\n"
@@ -182,19 +176,19 @@ namespace vk
 		"  };\n"
 		"  \n"
 		"  template<typename BitType>\n"
-		"  Flags<BitType> operator|( BitType bit, Flags<BitType> const& flags )\n"
+		"  VK_CPP_CONSTEXPR Flags<BitType> operator|( BitType bit, Flags<BitType> const& flags )\n"
 		"  {\n"
 		"    return flags | bit;\n"
 		"  }\n"
 		"  \n"
 		"  template<typename BitType>\n"
-		"  Flags<BitType> operator&( BitType bit, Flags<BitType> const& flags )\n"
+		"  VK_CPP_CONSTEXPR Flags<BitType> operator&( BitType bit, Flags<BitType> const& flags )\n"
 		"  {\n"
 		"    return flags & bit;\n"
 		"  }\n"
 		"  \n"
 		"  template<typename BitType>\n"
-		"  Flags<BitType> operator^( BitType bit, Flags<BitType> const& flags )\n"
+		"  VK_CPP_CONSTEXPR Flags<BitType> operator^( BitType bit, Flags<BitType> const& flags )\n"
 		"  {\n"
 		"    return flags ^ bit;\n"
 		"  }\n"
@@ -220,6 +214,9 @@ namespace vk
 	);
 
 	std::string const arrayProxyHeader = (
+		"  template <typename T, size_t N>\n"
+		"  class SmallVector;\n"
+		"\n"
 		"  template<typename T>\n"
 		"  class ArrayProxy\n"
 		"  {\n"
@@ -263,6 +260,18 @@ namespace vk
 		"      , m_ptr( data.data() )\n"
 		"    {}\n"
 		"\n"
+		"    template<size_t N>\n"
+		"    ArrayProxy( SmallVector<typename std::remove_const<T>::type, N>& data )\n"
+		"      : m_count( static_cast<uint32_t>( data.size() ) )\n"
+		"      , m_ptr( data.data() )\n"
+		"    {}\n"
+		"\n"
+		"    template<size_t N>\n"
+		"    ArrayProxy( SmallVector<typename std::remove_const<T>::type, N> const& data )\n"
+		"      : m_count( static_cast<uint32_t>( data.size() ) )\n"
+		"      , m_ptr( data.data() )\n"
+		"    {}\n"
+		"\n"
 		"    ArrayProxy( std::initializer_list<T> const& data )\n"
 		"      : m_count( static_cast<uint32_t>( data.end() - data.begin() ) )\n"
 		"      , m_ptr( data.begin() )\n"
@@ -285,6 +294,949 @@ namespace vk
 		"\n"
 	);
 
+	std::string const smallVectorHeader = (
+		"  template <typename T, size_t N>\n"
+		"  class SmallVector\n"
+		"  {\n"
+		"  public:\n"
+		"    typedef T value_type;\n"
+		"    typedef T* iterator;\n"
+		"    typedef T const* const_iterator;\n"
+		"\n"
+		"    SmallVector()\n"
+		"      : m_data( reinterpret_cast<T*>( m_storage ) )\n"
+		"      , m_size( 0 )\n"
+		"      , m_capacity( N )\n"
+		"    {}\n"
+		"\n"
+		"    SmallVector( SmallVector const& rhs )\n"
+		"      : SmallVector()\n"
+		"    {\n"
+		"      append( rhs.begin(), rhs.end() );\n"
+		"    }\n"
+		"\n"
+		"    SmallVector( SmallVector&& rhs )\n"
+		"      : SmallVector()\n"
+		"    {\n"
+		"      moveFrom( rhs );\n"
+		"    }\n"
+		"\n"
+		"    ~SmallVector()\n"
+		"    {\n"
+		"      clear();\n"
+		"      if ( !isInline() )\n"
+		"      {\n"
+		"        ::operator delete( m_data );\n"
+		"      }\n"
+		"    }\n"
+		"\n"
+		"    SmallVector& operator=( SmallVector const& rhs )\n"
+		"    {\n"
+		"      if ( this != &rhs )\n"
+		"      {\n"
+		"        clear();\n"
+		"        append( rhs.begin(), rhs.end() );\n"
+		"      }\n"
+		"      return *this;\n"
+		"    }\n"
+		"\n"
+		"    SmallVector& operator=( SmallVector&& rhs )\n"
+		"    {\n"
+		"      if ( this != &rhs )\n"
+		"      {\n"
+		"        moveFrom( rhs );\n"
+		"      }\n"
+		"      return *this;\n"
+		"    }\n"
+		"\n"
+		"    template <typename Allocator>\n"
+		"    operator std::vector<T, Allocator>() const\n"
+		"    {\n"
+		"      return std::vector<T, Allocator>( begin(), end() );\n"
+		"    }\n"
+		"\n"
+		"    size_t size() const { return m_size; }\n"
+		"    size_t capacity() const { return m_capacity; }\n"
+		"    bool empty() const { return m_size == 0; }\n"
+		"\n"
+		"    T* data() { return m_data; }\n"
+		"    T const* data() const { return m_data; }\n"
+		"\n"
+		"    iterator begin() { return m_data; }\n"
+		"    iterator end() { return m_data + m_size; }\n"
+		"    const_iterator begin() const { return m_data; }\n"
+		"    const_iterator end() const { return m_data + m_size; }\n"
+		"\n"
+		"    T& operator[]( size_t index ) { return m_data[index]; }\n"
+		"    T const& operator[]( size_t index ) const { return m_data[index]; }\n"
+		"\n"
+		"    T& front() { return m_data[0]; }\n"
+		"    T const& front() const { return m_data[0]; }\n"
+		"    T& back() { return m_data[m_size - 1]; }\n"
+		"    T const& back() const { return m_data[m_size - 1]; }\n"
+		"\n"
+		"    void reserve( size_t capacity )\n"
+		"    {\n"
+		"      if ( m_capacity < capacity )\n"
+		"      {\n"
+		"        T* data = static_cast<T*>( ::operator new( capacity * sizeof( T ) ) );\n"
+		"        for ( size_t i = 0; i < m_size; i++ )\n"
+		"        {\n"
+		"          new ( data + i ) T( std::move( m_data[i] ) );\n"
+		"          m_data[i].~T();\n"
+		"        }\n"
+		"        if ( !isInline() )\n"
+		"        {\n"
+		"          ::operator delete( m_data );\n"
+		"        }\n"
+		"        m_data = data;\n"
+		"        m_capacity = capacity;\n"
+		"      }\n"
+		"    }\n"
+		"\n"
+		"    void resize( size_t size )\n"
+		"    {\n"
+		"      reserve( size );\n"
+		"      for ( ; m_size < size; m_size++ )\n"
+		"      {\n"
+		"        new ( m_data + m_size ) T();\n"
+		"      }\n"
+		"      for ( ; size < m_size; m_size-- )\n"
+		"      {\n"
+		"        m_data[m_size - 1].~T();\n"
+		"      }\n"
+		"    }\n"
+		"\n"
+		"    void clear()\n"
+		"    {\n"
+		"      resize( 0 );\n"
+		"    }\n"
+		"\n"
+		"    void push_back( T const& value )\n"
+		"    {\n"
+		"      if ( m_size == m_capacity )\n"
+		"      {\n"
+		"        T copy( value );\n"
+		"        reserve( 2 * m_capacity );\n"
+		"        new ( m_data + m_size ) T( std::move( copy ) );\n"
+		"      }\n"
+		"      else\n"
+		"      {\n"
+		"        new ( m_data + m_size ) T( value );\n"
+		"      }\n"
+		"      m_size++;\n"
+		"    }\n"
+		"\n"
+		"    void pop_back()\n"
+		"    {\n"
+		"      m_data[--m_size].~T();\n"
+		"    }\n"
+		"\n"
+		"  private:\n"
+		"    bool isInline() const\n"
+		"    {\n"
+		"      return m_data == reinterpret_cast<T const*>( m_storage );\n"
+		"    }\n"
+		"\n"
+		"    void append( const_iterator first, const_iterator last )\n"
+		"    {\n"
+		"      reserve( m_size + ( last - first ) );\n"
+		"      for ( ; first != last; ++first, m_size++ )\n"
+		"      {\n"
+		"        new ( m_data + m_size ) T( *first );\n"
+		"      }\n"
+		"    }\n"
+		"\n"
+		"    // takes over the heap block of rhs, or moves its inline elements\n"
+		"    void moveFrom( SmallVector& rhs )\n"
+		"    {\n"
+		"      clear();\n"
+		"      if ( rhs.isInline() )\n"
+		"      {\n"
+		"        reserve( rhs.m_size );\n"
+		"        for ( ; m_size < rhs.m_size; m_size++ )\n"
+		"        {\n"
+		"          new ( m_data + m_size ) T( std::move( rhs.m_data[m_size] ) );\n"
+		"        }\n"
+		"        rhs.clear();\n"
+		"      }\n"
+		"      else\n"
+		"      {\n"
+		"        if ( !isInline() )\n"
+		"        {\n"
+		"          ::operator delete( m_data );\n"
+		"        }\n"
+		"        m_data = rhs.m_data;\n"
+		"        m_size = rhs.m_size;\n"
+		"        m_capacity = rhs.m_capacity;\n"
+		"        rhs.m_data = reinterpret_cast<T*>( rhs.m_storage );\n"
+		"        rhs.m_size = 0;\n"
+		"        rhs.m_capacity = N;\n"
+		"      }\n"
+		"    }\n"
+		"\n"
+		"    typename std::aligned_storage<sizeof( T ), alignof( T )>::type m_storage[N];\n"
+		"    T*      m_data;\n"
+		"    size_t  m_size;\n"
+		"    size_t  m_capacity;\n"
+		"  };\n"
+		"\n"
+		"  // selects SmallVector<T, N> as the result of an enumeration, instead of std::vector<T, Allocator>\n"
+		"  template <size_t N>\n"
+		"  struct InlineCapacity\n"
+		"  {};\n"
+		"\n"
+		"  template <typename T, typename Allocator>\n"
+		"  struct ResultVector\n"
+		"  {\n"
+		"    typedef std::vector<T, Allocator> type;\n"
+		"  };\n"
+		"\n"
+		"  template <typename T, size_t N>\n"
+		"  struct ResultVector<T, InlineCapacity<N>>\n"
+		"  {\n"
+		"    typedef SmallVector<T, N> type;\n"
+		"  };\n"
+		"\n"
+		"  // the projections of the elements of a range, on the stack up to N of them, to pass computed\n"
+		"  // arguments as an ArrayProxy for the duration of a call:\n"
+		"  //   commandBuffer.bindVertexBuffers( 0, stage<4>( meshes, []( Mesh const& m ) { return m.buffer; } ), offsets );\n"
+		"  template <size_t N, typename Range, typename Projection>\n"
+		"  auto stage( Range const& range, Projection projection )\n"
+		"    -> SmallVector<typename std::decay<decltype( projection( *std::begin( range ) ) )>::type, N>\n"
+		"  {\n"
+		"    SmallVector<typename std::decay<decltype( projection( *std::begin( range ) ) )>::type, N> staged;\n"
+		"    staged.reserve( static_cast<size_t>( std::distance( std::begin( range ), std::end( range ) ) ) );\n"
+		"    for ( auto it = std::begin( range ); it != std::end( range ); ++it )\n"
+		"    {\n"
+		"      staged.push_back( projection( *it ) );\n"
+		"    }\n"
+		"    return staged;\n"
+		"  }\n"
+		"\n"
+	);
+
+	std::string const toStringHeader = (
+		"  // an output iterator writing to a char buffer of the given size, which counts what doesn't fit\n"
+		"  class CharBufferIterator\n"
+		"  {\n"
+		"  public:\n"
+		"    CharBufferIterator( char* buffer, size_t size )\n"
+		"      : m_buffer( buffer )\n"
+		"      , m_size( size )\n"
+		"      , m_length( 0 )\n"
+		"    {}\n"
+		"\n"
+		"    CharBufferIterator& operator*() { return *this; }\n"
+		"    CharBufferIterator& operator++() { return *this; }\n"
+		"    CharBufferIterator& operator++( int ) { return *this; }\n"
+		"\n"
+		"    CharBufferIterator& operator=( char c )\n"
+		"    {\n"
+		"      if ( m_length + 1 < m_size )\n"
+		"      {\n"
+		"        m_buffer[m_length] = c;\n"
+		"      }\n"
+		"      m_length++;\n"
+		"      return *this;\n"
+		"    }\n"
+		"\n"
+		"    // terminates the (possibly truncated) text and returns its full length, like snprintf\n"
+		"    size_t finish()\n"
+		"    {\n"
+		"      if ( m_size )\n"
+		"      {\n"
+		"        m_buffer[m_length < m_size ? m_length : m_size - 1] = '\\0';\n"
+		"      }\n"
+		"      return m_length;\n"
+		"    }\n"
+		"\n"
+		"  private:\n"
+		"    char*   m_buffer;\n"
+		"    size_t  m_size;\n"
+		"    size_t  m_length;\n"
+		"  };\n"
+		"\n"
+		"  // writes \"{Name0 | Name1 | ...}\" to an output iterator\n"
+		"  template <typename OutputIt>\n"
+		"  class FlagsWriter\n"
+		"  {\n"
+		"  public:\n"
+		"    explicit FlagsWriter( OutputIt out )\n"
+		"      : m_out( out )\n"
+		"      , m_first( true )\n"
+		"    {\n"
+		"      *m_out++ = '{';\n"
+		"    }\n"
+		"\n"
+		"    void add( char const* name )\n"
+		"    {\n"
+		"      if ( !m_first )\n"
+		"      {\n"
+		"        write( \" | \" );\n"
+		"      }\n"
+		"      write( name );\n"
+		"      m_first = false;\n"
+		"    }\n"
+		"\n"
+		"    OutputIt finish()\n"
+		"    {\n"
+		"      *m_out++ = '}';\n"
+		"      return m_out;\n"
+		"    }\n"
+		"\n"
+		"  private:\n"
+		"    void write( char const* text )\n"
+		"    {\n"
+		"      for ( ; *text; ++text )\n"
+		"      {\n"
+		"        *m_out++ = *text;\n"
+		"      }\n"
+		"    }\n"
+		"\n"
+		"    OutputIt  m_out;\n"
+		"    bool      m_first;\n"
+		"  };\n"
+		"\n"
+	);
+
+	std::string const fromStringHeader = (
+		"  template <typename E>\n"
+		"  struct EnumName\n"
+		"  {\n"
+		"    E            value;\n"
+		"    char const*  name;\n"
+		"  };\n"
+		"\n"
+		"  // compares the text of the given length to a null terminated name, like strcmp\n"
+		"  inline int compareName( char const* text, size_t length, char const* name )\n"
+		"  {\n"
+		"    for ( size_t i = 0; i < length; ++i, ++name )\n"
+		"    {\n"
+		"      if ( text[i] != *name )\n"
+		"      {\n"
+		"        return ( !*name || static_cast<unsigned char>( *name ) < static_cast<unsigned char>( text[i] ) ) ? 1 : -1;\n"
+		"      }\n"
+		"    }\n"
+		"    return *name ? -1 : 0;\n"
+		"  }\n"
+		"\n"
+		"  // binary search in names sorted by name, the text may keep the leading 'e' of the enumerator\n"
+		"  template <typename E, size_t N>\n"
+		"  inline bool findEnumValue( EnumName<E> const (&names)[N], char const* text, size_t length, E& value )\n"
+		"  {\n"
+		"    if ( length && text[0] == 'e' )\n"
+		"    {\n"
+		"      ++text;\n"
+		"      --length;\n"
+		"    }\n"
+		"    size_t first = 0;\n"
+		"    size_t last = N;\n"
+		"    while ( first < last )\n"
+		"    {\n"
+		"      size_t middle = first + ( last - first ) / 2;\n"
+		"      int order = compareName( text, length, names[middle].name );\n"
+		"      if ( !order )\n"
+		"      {\n"
+		"        value = names[middle].value;\n"
+		"        return true;\n"
+		"      }\n"
+		"      if ( 0 < order )\n"
+		"      {\n"
+		"        first = middle + 1;\n"
+		"      }\n"
+		"      else\n"
+		"      {\n"
+		"        last = middle;\n"
+		"      }\n"
+		"    }\n"
+		"    return false;\n"
+		"  }\n"
+		"\n"
+		"  // drops the blanks around the text in [first, last)\n"
+		"  inline void trimName( char const*& first, char const*& last )\n"
+		"  {\n"
+		"    while ( first != last && ( *first == ' ' || *first == '\\t' ) )\n"
+		"    {\n"
+		"      ++first;\n"
+		"    }\n"
+		"    while ( first != last && ( last[-1] == ' ' || last[-1] == '\\t' ) )\n"
+		"    {\n"
+		"      --last;\n"
+		"    }\n"
+		"  }\n"
+		"\n"
+		"  // parses \"A | B | C\", or \"{A | B | C}\" as written by to_string, from the names of the bits\n"
+		"  template <typename BitType, typename MaskType>\n"
+		"  bool from_string( char const* text, size_t length, Flags<BitType, MaskType>& value )\n"
+		"  {\n"
+		"    char const* end = text + length;\n"
+		"    trimName( text, end );\n"
+		"    if ( text != end && *text == '{' )\n"
+		"    {\n"
+		"      if ( end - text < 2 || end[-1] != '}' )\n"
+		"      {\n"
+		"        return false;\n"
+		"      }\n"
+		"      ++text;\n"
+		"      --end;\n"
+		"      trimName( text, end );\n"
+		"    }\n"
+		"\n"
+		"    Flags<BitType, MaskType> result;\n"
+		"    while ( text != end )\n"
+		"    {\n"
+		"      char const* separator = std::find( text, end, '|' );\n"
+		"      char const* last = separator;\n"
+		"      trimName( text, last );\n"
+		"\n"
+		"      BitType bit;\n"
+		"      if ( !from_string( text, static_cast<size_t>( last - text ), bit ) )\n"
+		"      {\n"
+		"        return false;\n"
+		"      }\n"
+		"      result |= bit;\n"
+		"\n"
+		"      if ( separator == end )\n"
+		"      {\n"
+		"        break;\n"
+		"      }\n"
+		"      text = separator + 1;\n"
+		"      if ( text == end )\n"
+		"      {\n"
+		"        return false;\n"
+		"      }\n"
+		"    }\n"
+		"    value = result;\n"
+		"    return true;\n"
+		"  }\n"
+		"\n"
+	);
+
+	std::string const enumTableHeader = (
+		"  // binary search in names sorted by value\n"
+		"  template <typename E, size_t N>\n"
+		"  inline char const* findEnumName( EnumName<E> const (&names)[N], E value )\n"
+		"  {\n"
+		"    typedef typename std::underlying_type<E>::type Underlying;\n"
+		"    size_t first = 0;\n"
+		"    size_t last = N;\n"
+		"    while ( first < last )\n"
+		"    {\n"
+		"      size_t middle = first + ( last - first ) / 2;\n"
+		"      if ( static_cast<Underlying>( names[middle].value ) < static_cast<Underlying>( value ) )\n"
+		"      {\n"
+		"        first = middle + 1;\n"
+		"      }\n"
+		"      else\n"
+		"      {\n"
+		"        last = middle;\n"
+		"      }\n"
+		"    }\n"
+		"    return ( first < N && names[first].value == value ) ? names[first].name : \"invalid\";\n"
+		"  }\n"
+		"\n"
+		"  // direct index in the names of the values first, first + 1, ...\n"
+		"  template <typename E, size_t N>\n"
+		"  inline char const* findEnumName( char const* const (&names)[N], E first, E value )\n"
+		"  {\n"
+		"    typedef typename std::underlying_type<E>::type Underlying;\n"
+		"    size_t index = static_cast<size_t>( static_cast<int64_t>( static_cast<Underlying>( value ) ) - static_cast<Underlying>( first ) );\n"
+		"    return index < N ? names[index] : \"invalid\";\n"
+		"  }\n"
+		"\n"
+		"  inline unsigned countTrailingZeros( uint32_t mask )\n"
+		"  {\n"
+		"#if defined( __GNUC__ ) || defined( __clang__ )\n"
+		"    return __builtin_ctz( mask );\n"
+		"#elif defined( _MSC_VER )\n"
+		"    unsigned long index;\n"
+		"    _BitScanForward( &index, mask );\n"
+		"    return index;\n"
+		"#else\n"
+		"    unsigned index = 0;\n"
+		"    for ( ; !( mask & 1 ); mask >>= 1 )\n"
+		"    {\n"
+		"      index++;\n"
+		"    }\n"
+		"    return index;\n"
+		"#endif\n"
+		"  }\n"
+		"\n"
+		"  // names of the bits 0 to N - 1, nullptr if bit isn't a single named bit\n"
+		"  template <size_t N>\n"
+		"  inline char const* findBitName( char const* const (&names)[N], uint32_t bit )\n"
+		"  {\n"
+		"    if ( !bit || ( bit & ( bit - 1 ) ) )\n"
+		"    {\n"
+		"      return nullptr;\n"
+		"    }\n"
+		"    unsigned index = countTrailingZeros( bit );\n"
+		"    return index < N ? names[index] : nullptr;\n"
+		"  }\n"
+		"\n"
+	);
+
+	std::string const commandStreamHeader = (
+		"  // commands recorded to be replayed later, in 8 byte words. A record starts with a word holding its\n"
+		"  // opcode in the low half and its size in words, header included, in the high half. The arguments\n"
+		"  // follow, with the arrays they point to copied inline.\n"
+		"  template <typename Allocator = std::allocator<uint64_t>>\n"
+		"  class CommandStream\n"
+		"  {\n"
+		"  public:\n"
+		"    // the records, to walk, filter or reorder them before a replay\n"
+		"    std::vector<uint64_t, Allocator> const& words() const\n"
+		"    {\n"
+		"      return m_words;\n"
+		"    }\n"
+		"\n"
+		"    bool empty() const\n"
+		"    {\n"
+		"      return m_words.empty();\n"
+		"    }\n"
+		"\n"
+		"    void clear()\n"
+		"    {\n"
+		"      m_words.clear();\n"
+		"    }\n"
+		"\n"
+		"    void reserve( size_t words )\n"
+		"    {\n"
+		"      m_words.reserve( words );\n"
+		"    }\n"
+		"\n"
+		"    // appends the records of another stream, to replay the streams of several threads at once\n"
+		"    template <typename OtherAllocator>\n"
+		"    void append( CommandStream<OtherAllocator> const& rhs )\n"
+		"    {\n"
+		"      m_words.insert( m_words.end(), rhs.words().begin(), rhs.words().end() );\n"
+		"    }\n"
+		"\n"
+		"    size_t beginRecord( uint32_t opcode )\n"
+		"    {\n"
+		"      m_words.push_back( opcode );\n"
+		"      return m_words.size() - 1;\n"
+		"    }\n"
+		"\n"
+		"    void endRecord( size_t header )\n"
+		"    {\n"
+		"      m_words[header] |= static_cast<uint64_t>( m_words.size() - header ) << 32;\n"
+		"    }\n"
+		"\n"
+		"    template <typename T>\n"
+		"    void write( T const* data, size_t count )\n"
+		"    {\n"
+		"      size_t size = count * sizeof( T );\n"
+		"      if ( size )\n"
+		"      {\n"
+		"        size_t offset = m_words.size();\n"
+		"        m_words.resize( offset + ( size + 7 ) / 8 );\n"
+		"        memcpy( &m_words[offset], data, size );\n"
+		"      }\n"
+		"    }\n"
+		"\n"
+		"    // writes the count first, for arrays whose count isn't an argument\n"
+		"    template <typename T>\n"
+		"    void writeArray( T const* data, size_t count )\n"
+		"    {\n"
+		"      m_words.push_back( count );\n"
+		"      write( data, count );\n"
+		"    }\n"
+		"\n"
+		"  private:\n"
+		"    std::vector<uint64_t, Allocator> m_words;\n"
+		"  };\n"
+		"\n"
+		"  // reads the arguments of a record back, in the order they were written\n"
+		"  class CommandArguments\n"
+		"  {\n"
+		"  public:\n"
+		"    explicit CommandArguments( uint64_t const* words )\n"
+		"      : m_words( words )\n"
+		"    {}\n"
+		"\n"
+		"    template <typename T>\n"
+		"    T const* read( size_t count )\n"
+		"    {\n"
+		"      T const* data = reinterpret_cast<T const*>( m_words );\n"
+		"      m_words += ( count * sizeof( T ) + 7 ) / 8;\n"
+		"      return data;\n"
+		"    }\n"
+		"\n"
+		"    // nullptr for an empty array\n"
+		"    template <typename T>\n"
+		"    T const* readArray()\n"
+		"    {\n"
+		"      size_t count = static_cast<size_t>( *m_words++ );\n"
+		"      return count ? read<T>( count ) : nullptr;\n"
+		"    }\n"
+		"\n"
+		"  private:\n"
+		"    uint64_t const* m_words;\n"
+		"  };\n"
+		"\n"
+	);
+
+	std::string const descriptorUpdateBatchHeader = (
+		"  // descriptor writes and copies gathered through a frame, and made in a single vkUpdateDescriptorSets.\n"
+		"  // The infos of the writes are copied into arrays of their own, and flush() points the writes to\n"
+		"  // them once they stopped growing. The arrays keep their capacity, so a batch reused every frame\n"
+		"  // stops allocating once it saw its largest frame.\n"
+		"  class DescriptorUpdateBatch\n"
+		"  {\n"
+		"  public:\n"
+		"    // the infos of the write, as its descriptor type selects them, are copied\n"
+		"    void write( WriteDescriptorSet const& descriptorWrite )\n"
+		"    {\n"
+		"      m_writes.push_back( descriptorWrite );\n"
+		"      WriteDescriptorSet& batched = m_writes.back();\n"
+		"      batched.pImageInfo = nullptr;\n"
+		"      batched.pBufferInfo = nullptr;\n"
+		"      batched.pTexelBufferView = nullptr;\n"
+		"      switch ( descriptorWrite.descriptorType )\n"
+		"      {\n"
+		"        case DescriptorType::eUniformTexelBuffer:\n"
+		"        case DescriptorType::eStorageTexelBuffer:\n"
+		"          m_firstInfos.push_back( append( m_texelBufferViews, descriptorWrite.pTexelBufferView, descriptorWrite.descriptorCount ) );\n"
+		"          batched.pTexelBufferView = m_texelBufferViews.data();\n"
+		"          break;\n"
+		"        case DescriptorType::eUniformBuffer:\n"
+		"        case DescriptorType::eStorageBuffer:\n"
+		"        case DescriptorType::eUniformBufferDynamic:\n"
+		"        case DescriptorType::eStorageBufferDynamic:\n"
+		"          m_firstInfos.push_back( append( m_bufferInfos, descriptorWrite.pBufferInfo, descriptorWrite.descriptorCount ) );\n"
+		"          batched.pBufferInfo = m_bufferInfos.data();\n"
+		"          break;\n"
+		"        default:\n"
+		"          m_firstInfos.push_back( append( m_imageInfos, descriptorWrite.pImageInfo, descriptorWrite.descriptorCount ) );\n"
+		"          batched.pImageInfo = m_imageInfos.data();\n"
+		"          break;\n"
+		"      }\n"
+		"    }\n"
+		"\n"
+		"    void write( DescriptorSet dstSet, uint32_t dstBinding, uint32_t dstArrayElement, DescriptorType descriptorType, ArrayProxy<const DescriptorImageInfo> imageInfo )\n"
+		"    {\n"
+		"      write( WriteDescriptorSet( dstSet, dstBinding, dstArrayElement, imageInfo.size(), descriptorType, imageInfo.data(), nullptr, nullptr ) );\n"
+		"    }\n"
+		"\n"
+		"    void write( DescriptorSet dstSet, uint32_t dstBinding, uint32_t dstArrayElement, DescriptorType descriptorType, ArrayProxy<const DescriptorBufferInfo> bufferInfo )\n"
+		"    {\n"
+		"      write( WriteDescriptorSet( dstSet, dstBinding, dstArrayElement, bufferInfo.size(), descriptorType, nullptr, bufferInfo.data(), nullptr ) );\n"
+		"    }\n"
+		"\n"
+		"    void write( DescriptorSet dstSet, uint32_t dstBinding, uint32_t dstArrayElement, DescriptorType descriptorType, ArrayProxy<const BufferView> texelBufferView )\n"
+		"    {\n"
+		"      write( WriteDescriptorSet( dstSet, dstBinding, dstArrayElement, texelBufferView.size(), descriptorType, nullptr, nullptr, texelBufferView.data() ) );\n"
+		"    }\n"
+		"\n"
+		"    void copy( CopyDescriptorSet const& descriptorCopy )\n"
+		"    {\n"
+		"      m_copies.push_back( descriptorCopy );\n"
+		"    }\n"
+		"\n"
+		"    bool empty() const\n"
+		"    {\n"
+		"      return m_writes.empty() && m_copies.empty();\n"
+		"    }\n"
+		"\n"
+		"    void clear()\n"
+		"    {\n"
+		"      m_writes.clear();\n"
+		"      m_firstInfos.clear();\n"
+		"      m_copies.clear();\n"
+		"      m_imageInfos.clear();\n"
+		"      m_bufferInfos.clear();\n"
+		"      m_texelBufferViews.clear();\n"
+		"    }\n"
+		"\n"
+		"    template <typename Dispatch = VK_CPP_DEFAULT_DISPATCH>\n"
+		"    void flush( Device device, Dispatch const& d = DefaultDispatch<Dispatch>::dispatch )\n"
+		"    {\n"
+		"      if ( empty() )\n"
+		"      {\n"
+		"        return;\n"
+		"      }\n"
+		"\n"
+		"      // the arrays the infos were copied to may have moved since\n"
+		"      for ( size_t i = 0; i < m_writes.size(); i++ )\n"
+		"      {\n"
+		"        if ( m_writes[i].pImageInfo )\n"
+		"        {\n"
+		"          m_writes[i].pImageInfo = m_imageInfos.data() + m_firstInfos[i];\n"
+		"        }\n"
+		"        else if ( m_writes[i].pBufferInfo )\n"
+		"        {\n"
+		"          m_writes[i].pBufferInfo = m_bufferInfos.data() + m_firstInfos[i];\n"
+		"        }\n"
+		"        else if ( m_writes[i].pTexelBufferView )\n"
+		"        {\n"
+		"          m_writes[i].pTexelBufferView = m_texelBufferViews.data() + m_firstInfos[i];\n"
+		"        }\n"
+		"      }\n"
+		"      device.updateDescriptorSets( m_writes, m_copies, d );\n"
+		"      clear();\n"
+		"    }\n"
+		"\n"
+		"  private:\n"
+		"    template <typename T>\n"
+		"    static size_t append( std::vector<T>& infos, T const* first, uint32_t count )\n"
+		"    {\n"
+		"      infos.insert( infos.end(), first, first + count );\n"
+		"      return infos.size() - count;\n"
+		"    }\n"
+		"\n"
+		"    std::vector<WriteDescriptorSet>   m_writes;\n"
+		"    std::vector<size_t>               m_firstInfos;\n"
+		"    std::vector<CopyDescriptorSet>    m_copies;\n"
+		"    std::vector<DescriptorImageInfo>  m_imageInfos;\n"
+		"    std::vector<DescriptorBufferInfo> m_bufferInfos;\n"
+		"    std::vector<BufferView>           m_texelBufferViews;\n"
+		"  };\n"
+		"\n"
+	);
+
+	std::string const uniqueHandleHeader = (
+		"#if defined( _MSC_VER ) && ( _MSC_VER == 1800 )\n"
+		"# define noexcept _NOEXCEPT\n"
+		"#endif\n"
+		"\n"
+		"  // owns a handle, and destroys it through the deleter it points to. A deleter holds what the destroy\n"
+		"  // command needs besides the handle, like the parent and the allocator, and is shared by all the\n"
+		"  // handles it destroys, which it must outlive. A unique handle so is two pointers large, and moves\n"
+		"  // as cheaply as a plain handle when a std::vector grows.\n"
+		"  template <typename Type, typename Deleter>\n"
+		"  class UniqueHandle\n"
+		"  {\n"
+		"  public:\n"
+		"    UniqueHandle()\n"
+		"      : m_value()\n"
+		"      , m_deleter( nullptr )\n"
+		"    {}\n"
+		"\n"
+		"    UniqueHandle( Type value, Deleter const& deleter )\n"
+		"      : m_value( value )\n"
+		"      , m_deleter( &deleter )\n"
+		"    {}\n"
+		"\n"
+		"    UniqueHandle( UniqueHandle const& rhs ) = delete;\n"
+		"\n"
+		"    UniqueHandle( UniqueHandle&& rhs ) noexcept\n"
+		"      : m_value( rhs.release() )\n"
+		"      , m_deleter( rhs.m_deleter )\n"
+		"    {}\n"
+		"\n"
+		"    ~UniqueHandle()\n"
+		"    {\n"
+		"      destroy();\n"
+		"    }\n"
+		"\n"
+		"    UniqueHandle& operator=( UniqueHandle const& rhs ) = delete;\n"
+		"\n"
+		"    UniqueHandle& operator=( UniqueHandle&& rhs ) noexcept\n"
+		"    {\n"
+		"      reset( rhs.release() );\n"
+		"      m_deleter = rhs.m_deleter;\n"
+		"      return *this;\n"
+		"    }\n"
+		"\n"
+		"    explicit operator bool() const\n"
+		"    {\n"
+		"      return static_cast<bool>( m_value );\n"
+		"    }\n"
+		"\n"
+		"    Type const* operator->() const\n"
+		"    {\n"
+		"      return &m_value;\n"
+		"    }\n"
+		"\n"
+		"    Type const& operator*() const\n"
+		"    {\n"
+		"      return m_value;\n"
+		"    }\n"
+		"\n"
+		"    Type const& get() const\n"
+		"    {\n"
+		"      return m_value;\n"
+		"    }\n"
+		"\n"
+		"    Deleter const* getDeleter() const\n"
+		"    {\n"
+		"      return m_deleter;\n"
+		"    }\n"
+		"\n"
+		"    // destroys the handle owned, and takes the one given through the same deleter\n"
+		"    void reset( Type value = Type() )\n"
+		"    {\n"
+		"      destroy();\n"
+		"      m_value = value;\n"
+		"    }\n"
+		"\n"
+		"    Type release()\n"
+		"    {\n"
+		"      Type value = m_value;\n"
+		"      m_value = Type();\n"
+		"      return value;\n"
+		"    }\n"
+		"\n"
+		"    void swap( UniqueHandle& rhs ) noexcept\n"
+		"    {\n"
+		"      std::swap( m_value, rhs.m_value );\n"
+		"      std::swap( m_deleter, rhs.m_deleter );\n"
+		"    }\n"
+		"\n"
+		"  private:\n"
+		"    void destroy()\n"
+		"    {\n"
+		"      if ( m_value )\n"
+		"      {\n"
+		"        ( *m_deleter )( m_value );\n"
+		"      }\n"
+		"    }\n"
+		"\n"
+		"    Type           m_value;\n"
+		"    Deleter const* m_deleter;\n"
+		"  };\n"
+		"\n"
+		"  template <typename Type, typename Deleter>\n"
+		"  inline void swap( UniqueHandle<Type, Deleter>& lhs, UniqueHandle<Type, Deleter>& rhs ) noexcept\n"
+		"  {\n"
+		"    lhs.swap( rhs );\n"
+		"  }\n"
+		"\n"
+		"#if defined( _MSC_VER ) && ( _MSC_VER == 1800 )\n"
+		"# undef noexcept\n"
+		"#endif\n"
+		"\n"
+	);
+
+	std::string const deferredDeleterHeader = (
+		"  // destroys handles once the device is done with them, without waiting for it to be idle. The handles\n"
+		"  // given to it, from any thread, join the frame being recorded, in a list they are pushed to without\n"
+		"  // a lock. nextFrame() closes that frame with the fence its submissions signal, and collect() destroys,\n"
+		"  // through the deleter, the handles of the frames whose fence signaled. A frame reused before its\n"
+		"  // fence signaled waits for the later fence, so the fences are expected to signal in order, as those\n"
+		"  // of a single queue do. A DeferredDeleter can be the deleter of a UniqueHandle.\n"
+		"  template <typename Deleter, typename Dispatch = VK_CPP_DEFAULT_DISPATCH>\n"
+		"  class DeferredDeleter\n"
+		"  {\n"
+		"  public:\n"
+		"    // frameCount is the number of frames in flight, besides the one being recorded\n"
+		"    DeferredDeleter( Device device, Deleter const& deleter, size_t frameCount = 3, Dispatch const& d = DefaultDispatch<Dispatch>::dispatch )\n"
+		"      : m_device( device )\n"
+		"      , m_deleter( &deleter )\n"
+		"      , m_dispatch( &d )\n"
+		"      , m_frames( frameCount + 1 )\n"
+		"      , m_frame( 0 )\n"
+		"    {}\n"
+		"\n"
+		"    DeferredDeleter( DeferredDeleter const& rhs ) = delete;\n"
+		"    DeferredDeleter& operator=( DeferredDeleter const& rhs ) = delete;\n"
+		"\n"
+		"    // the device is idle by now, what is left is destroyed\n"
+		"    ~DeferredDeleter()\n"
+		"    {\n"
+		"      for ( auto& frame : m_frames )\n"
+		"      {\n"
+		"        destroy( frame );\n"
+		"      }\n"
+		"    }\n"
+		"\n"
+		"    template <typename Type>\n"
+		"    void operator()( Type value ) const\n"
+		"    {\n"
+		"      static_assert( sizeof( Type ) <= sizeof( uint64_t ), \"only handles can be deferred\" );\n"
+		"      Node* node = new Node;\n"
+		"      node->destroy = &destroyHandle<Type>;\n"
+		"      memcpy( &node->handle, &value, sizeof( Type ) );\n"
+		"\n"
+		"      // a frame closed meanwhile only delays the destruction to the next time it is collected\n"
+		"      Frame& frame = m_frames[m_frame.load( std::memory_order_acquire ) % m_frames.size()];\n"
+		"      node->next = frame.head.load( std::memory_order_relaxed );\n"
+		"      while ( !frame.head.compare_exchange_weak( node->next, node, std::memory_order_release, std::memory_order_relaxed ) )\n"
+		"      {}\n"
+		"    }\n"
+		"\n"
+		"    // closes the frame being recorded, from the thread submitting it. The next frame reuses the oldest\n"
+		"    // one, whose handles are destroyed first if its fence signaled.\n"
+		"    void nextFrame( Fence fence )\n"
+		"    {\n"
+		"      size_t frame = m_frame.load( std::memory_order_relaxed );\n"
+		"      m_frames[frame % m_frames.size()].fence = fence;\n"
+		"      collect( m_frames[( frame + 1 ) % m_frames.size()] );\n"
+		"      m_frame.store( frame + 1, std::memory_order_release );\n"
+		"    }\n"
+		"\n"
+		"    // destroys the handles of the closed frames whose fence signaled, from the thread calling nextFrame()\n"
+		"    void collect()\n"
+		"    {\n"
+		"      size_t current = m_frame.load( std::memory_order_relaxed ) % m_frames.size();\n"
+		"      for ( size_t i = 0; i < m_frames.size(); i++ )\n"
+		"      {\n"
+		"        if ( i != current )\n"
+		"        {\n"
+		"          collect( m_frames[i] );\n"
+		"        }\n"
+		"      }\n"
+		"    }\n"
+		"\n"
+		"  private:\n"
+		"    struct Node\n"
+		"    {\n"
+		"      Node*    next;\n"
+		"      void     ( *destroy )( Deleter const& deleter, uint64_t handle );\n"
+		"      uint64_t handle;\n"
+		"    };\n"
+		"\n"
+		"    struct Frame\n"
+		"    {\n"
+		"      Frame()\n"
+		"        : head( nullptr )\n"
+		"      {}\n"
+		"\n"
+		"      std::atomic<Node*> head;\n"
+		"      Fence              fence;\n"
+		"    };\n"
+		"\n"
+		"    void collect( Frame& frame )\n"
+		"    {\n"
+		"      if ( frame.fence\n"
+		"        && m_dispatch->vkGetFenceStatus( static_cast<VkDevice>( m_device ), static_cast<VkFence>( frame.fence ) ) == VK_SUCCESS )\n"
+		"      {\n"
+		"        frame.fence = Fence();\n"
+		"        destroy( frame );\n"
+		"      }\n"
+		"    }\n"
+		"\n"
+		"    template <typename Type>\n"
+		"    static void destroyHandle( Deleter const& deleter, uint64_t handle )\n"
+		"    {\n"
+		"      Type value;\n"
+		"      memcpy( static_cast<void*>( &value ), &handle, sizeof( Type ) );\n"
+		"      deleter( value );\n"
+		"    }\n"
+		"\n"
+		"    void destroy( Frame& frame )\n"
+		"    {\n"
+		"      Node* node = frame.head.exchange( nullptr, std::memory_order_acquire );\n"
+		"      while ( node )\n"
+		"      {\n"
+		"        Node* next = node->next;\n"
+		"        node->destroy( *m_deleter, node->handle );\n"
+		"        delete node;\n"
+		"        node = next;\n"
+		"      }\n"
+		"    }\n"
+		"\n"
+		"    Device                     m_device;\n"
+		"    Deleter const*             m_deleter;\n"
+		"    Dispatch const*            m_dispatch;\n"
+		"    mutable std::vector<Frame> m_frames;\n"
+		"    std::atomic<size_t>        m_frame;\n"
+		"  };\n"
+		"\n"
+	);
+
 	std::string const versionCheckHeader = (
 		"#ifndef VK_CPP_HAS_UNRESTRICTED_UNIONS\n"
 		"# ifdef __clang__\n"
@@ -292,7 +1244,7 @@ namespace vk
 		"#   define VK_CPP_HAS_UNRESTRICTED_UNIONS\n"
 		"#  endif\n"
 		"# elif defined( __GNUC__ )\n"
-		"#  define GCC_VERSION ( __GNUC__ * 1000 + __GNUC_MINOR__ * 100 + __GNUC_PATCHLEVEL__ )\n"
+		"#  define GCC_VERSION ( __GNUC__ * 10000 + __GNUC_MINOR__ * 100 + __GNUC_PATCHLEVEL__ )\n"
 		"#  if 40600 <= GCC_VERSION\n"
 		"#   define VK_CPP_HAS_UNRESTRICTED_UNIONS\n"
 		"#  endif\n"
@@ -301,6 +1253,23 @@ namespace vk
 		"#   define VK_CPP_HAS_UNRESTRICTED_UNIONS\n"
 		"#  endif\n"
 		"# endif\n"
+		"#endif\n"
+		"\n"
+		"// std::is_trivially_copyable came with libstdc++ 5\n"
+		"#ifndef VK_CPP_HAS_TRIVIALLY_COPYABLE\n"
+		"# if !defined( __GNUC__ ) || defined( __clang__ ) || 5 <= __GNUC__\n"
+		"#  define VK_CPP_HAS_TRIVIALLY_COPYABLE\n"
+		"# endif\n"
+		"#endif\n\n"
+	);
+
+	std::string const constexprHeader = (
+		"#ifndef VK_CPP_CONSTEXPR\n"
+		"# if ( defined( __cpp_constexpr ) && 201304 <= __cpp_constexpr ) || ( defined( _MSC_VER ) && 1910 <= _MSC_VER )\n"
+		"#  define VK_CPP_CONSTEXPR constexpr\n"
+		"# else\n"
+		"#  define VK_CPP_CONSTEXPR\n"
+		"# endif\n"
 		"#endif\n\n"
 	);
 
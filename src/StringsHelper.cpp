@@ -1,23 +1,21 @@
 #include "StringsHelper.h"
 #include <cassert>
+#include <cctype>
 #include <algorithm>
 
 namespace vk
 {
 	//--------------------------------------------------------------------------
-	std::string StringsHelper::trimEnd( std::string const& input )
+	StringRef StringsHelper::trimEnd( StringRef input )
 	{
-		std::string result = input;
-		result.erase( std::find_if(
-						  result.rbegin(),
-						  result.rend(),
-						  std::not1( std::ptr_fun<int, int>( std::isspace ) )
-						  ).base(), result.end()
-		);
-		return result;
+		size_t size = input.size();
+		while( size && std::isspace( static_cast<unsigned char>( input[ size - 1 ] ) ) )
+			size--;
+
+		return input.substr( 0, size );
 	}
 	//--------------------------------------------------------------------------
-	std::string StringsHelper::toCamelCase( std::string const& value )
+	std::string StringsHelper::toCamelCase( StringRef value )
 	{
 		assert( !value.empty() && ( isupper( value[ 0 ] ) || isdigit( value[ 0 ] ) ) );
 		std::string result;
@@ -37,7 +35,7 @@ namespace vk
 		return result;
 	}
 	//--------------------------------------------------------------------------
-	std::string StringsHelper::toUpperCase( std::string const& name )
+	std::string StringsHelper::toUpperCase( StringRef name )
 	{
 		assert( isupper( name.front() ) );
 		std::string convertedName;
@@ -53,19 +51,19 @@ namespace vk
 		return convertedName;
 	}
 	//--------------------------------------------------------------------------
-	std::string StringsHelper::strip( std::string const& value,
-									  std::string const& prefix,
-									  std::string const& postfix )
+	StringRef StringsHelper::strip( StringRef value,
+									StringRef prefix,
+									StringRef postfix )
 	{
-		std::string strippedValue = value;
+		StringRef strippedValue = value;
 		if( strippedValue.find( prefix ) == 0 )
-			strippedValue.erase( 0, prefix.length() );
+			strippedValue = strippedValue.substr( prefix.length() );
 
 		if( !postfix.empty() )
 		{
 			size_t pos = strippedValue.rfind( postfix );
-			assert( pos != std::string::npos );
-			strippedValue.erase( pos );
+			assert( pos != StringRef::npos );
+			strippedValue = strippedValue.substr( 0, pos );
 		}
 		return strippedValue;
 	}
@@ -2,21 +2,23 @@
 #define STRINGSHELPER_H
 
 #include <string>
+#include "VkStringRef.h"
 
 namespace vk
 {
 	class StringsHelper
 	{
 	public:
-		static std::string trimEnd( std::string const& input );
+		// trimEnd and strip only narrow their input, the result refers to it
+		static StringRef trimEnd( StringRef input );
 
-		static std::string toCamelCase( std::string const& value );
+		static std::string toCamelCase( StringRef value );
 
-		static std::string toUpperCase( std::string const& name );
+		static std::string toUpperCase( StringRef name );
 
-		static std::string strip( std::string const& value,
-								  std::string const& prefix,
-								  std::string const& tag = "" );
+		static StringRef strip( StringRef value,
+								StringRef prefix,
+								StringRef tag = StringRef() );
 
 	private:
 		StringsHelper() {}
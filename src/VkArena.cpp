@@ -0,0 +1,76 @@
+// Copyright(c) 2015-2016, NVIDIA CORPORATION. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "VkArena.h"
+#include <cassert>
+#include <cstdint>
+#include <new>
+
+namespace vk
+{
+	Arena::Arena( size_t blockSize )
+		: _blockSize( blockSize )
+	{
+		assert( blockSize );
+	}
+	//--------------------------------------------------------------------------
+	Arena::~Arena()
+	{
+		while( _blocks )
+		{
+			Block* next = _blocks->next;
+			::operator delete( _blocks );
+			_blocks = next;
+		}
+	}
+	//--------------------------------------------------------------------------
+	void* Arena::allocate( size_t size, size_t alignment )
+	{
+		assert( alignment && !( alignment & ( alignment - 1 ) ) );
+		uintptr_t p = ( reinterpret_cast<uintptr_t>( _current ) + alignment - 1 ) & ~( alignment - 1 );
+
+		if( !_current || reinterpret_cast<uintptr_t>( _end ) < p + size )
+		{
+			_newBlock( size + alignment );
+			p = ( reinterpret_cast<uintptr_t>( _current ) + alignment - 1 ) & ~( alignment - 1 );
+		}
+
+		_current = reinterpret_cast<char*>( p + size );
+		return reinterpret_cast<void*>( p );
+	}
+	//--------------------------------------------------------------------------
+	void Arena::_newBlock( size_t minSize )
+	{
+		// oversized requests get a block of their own
+		size_t size = sizeof( Block ) + ( minSize < _blockSize ? _blockSize : minSize );
+		Block* block = static_cast<Block*>( ::operator new( size ) );
+		block->next = _blocks;
+		_blocks = block;
+		_reserved += size;
+
+		_current = reinterpret_cast<char*>( block + 1 );
+		_end = reinterpret_cast<char*>( block ) + size;
+	}
+}
@@ -0,0 +1,107 @@
+// Copyright(c) 2015-2016, NVIDIA CORPORATION. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#ifndef VKARENA_H
+#define VKARENA_H
+
+#include <cstddef>
+
+namespace vk
+{
+	/**
+	 * @brief monotonic allocator. Memory is handed out from large blocks and
+	 * is only given back, all at once, when the arena is destroyed.
+	 */
+	class Arena
+	{
+	public:
+		explicit Arena( size_t blockSize = 64 * 1024 );
+		~Arena();
+
+		Arena( Arena const& ) = delete;
+		Arena& operator=( Arena const& ) = delete;
+
+		void* allocate( size_t size, size_t alignment );
+
+		/**
+		 * @brief total size of the blocks reserved so far.
+		 */
+		size_t reserved() const { return _reserved; }
+
+	private:
+		struct Block
+		{
+			Block* next;
+		};
+
+		void _newBlock( size_t minSize );
+
+		Block*	_blocks = nullptr;
+		char*	_current = nullptr;
+		char*	_end = nullptr;
+		size_t	_blockSize;
+		size_t	_reserved = 0;
+	};
+
+	/**
+	 * @brief standard allocator drawing from an Arena; deallocate is a no-op.
+	 */
+	template<typename T>
+	class ArenaAllocator
+	{
+	public:
+		typedef T value_type;
+
+		ArenaAllocator( Arena& arena )
+			: _arena( &arena )
+		{}
+
+		template<typename U>
+		ArenaAllocator( ArenaAllocator<U> const& rhs )
+			: _arena( rhs._arena )
+		{}
+
+		T* allocate( size_t n )
+		{
+			return static_cast<T*>( _arena->allocate( n * sizeof( T ), alignof( T ) ) );
+		}
+
+		void deallocate( T*, size_t )
+		{}
+
+		template<typename U>
+		bool operator==( ArenaAllocator<U> const& rhs ) const { return _arena == rhs._arena; }
+
+		template<typename U>
+		bool operator!=( ArenaAllocator<U> const& rhs ) const { return _arena != rhs._arena; }
+
+	private:
+		template<typename U>
+		friend class ArenaAllocator;
+
+		Arena* _arena;
+	};
+}
+#endif // VKARENA_H
@@ -1,1834 +1,3083 @@
-// Copyright(c) 2015-2016, NVIDIA CORPORATION. All rights reserved.
-//
-// Redistribution and use in source and binary forms, with or without
-// modification, are permitted provided that the following conditions
-// are met:
-//  * Redistributions of source code must retain the above copyright
-//    notice, this list of conditions and the following disclaimer.
-//  * Redistributions in binary form must reproduce the above copyright
-//    notice, this list of conditions and the following disclaimer in the
-//    documentation and/or other materials provided with the distribution.
-//  * Neither the name of NVIDIA CORPORATION nor the names of its
-//    contributors may be used to endorse or promote products derived
-//    from this software without specific prior written permission.
-//
-// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
-// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
-// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
-// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
-// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
-// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
-// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
-// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
-// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
-// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
-// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-#include "VkDualOFStream.h"
-#include "Strings.h"
-#include "StringsHelper.h"
-
-#include <iostream>
-#include <cassert>
-#include <exception>
-#include <algorithm>
-#include <sstream>
-#include <functional>
-
-namespace vk
-{
-	int CppGenerator::generate( const Options& opt )
-	{
-		SpecParser parser;
-		auto vkData = parser.parse( opt.inputFile );
-		if( !vkData )
-			return -1;
-
-		_sortDependencies( vkData->dependencies );
-
-		std::map<std::string, std::string> defaultValues;
-		_createDefaults( vkData, defaultValues );
-
-		try
-		{
-			DualOFStream ofs( opt );
-			_indent.setIndentChar( opt.indentChar );
-			_indent.setSize( opt.spaceSize );
-
-			ofs << nvidiaLicenseHeader
-				<< vkData->vulkanLicenseHeader << std::endl
-				<< ( !opt.cmdLine.empty() ? "// Command line options: " + opt.cmdLine + "\n" : "" );
-
-			if( ofs.usingDualStream() )
-			{
-				if( !opt.pch.empty() )
-					ofs.src() << "#include \"" << opt.pch << "\"\n";
-
-				ofs.src() << "#include \"" << ofs.headerFileName() << "\"\n";
-			}
-
-			ofs.hdr() << "#ifndef " << opt.includeGuard << std::endl
-				<< "#define " << opt.includeGuard << std::endl << std::endl;
-
-			ofs.src() << "#include <cassert>\n"
-					  << "#include <cstdint>\n"
-					  << "#include <cstring>\n"
-					  << "#include <string>\n"
-					  << "#include <system_error>\n";
-
-			ofs.hdr() << "#include <array>\n"
-					  << "#include <algorithm>\n"
-					  << "#include <vulkan/vulkan.h>\n"
-					  << "#ifndef VKCPP_DISABLE_ENHANCED_MODE\n"
-					  << "#" << _indent + 1 << "include <vector>\n"
-					  << "#endif /*VKCPP_DISABLE_ENHANCED_MODE*/\n\n";
-
-			_writeVersionCheck( ofs.src(), vkData->version );
-			_writeTypesafeCheck( ofs.hdr(), vkData->typesafeCheck );
-
-			ofs.hdr() << versionCheckHeader;
-			ofs << "namespace vk\n"
-				<< "{\n";
-
-			++_indent;
-
-			ofs.hdr() << flagsHeader
-					  << optionalClassHeader
-					  << arrayProxyHeader;
-
-			// first of all, write out vk::Result and the exception handling stuff
-			auto it = std::find_if(
-						vkData->dependencies.begin(),
-						vkData->dependencies.end(),
-						[]( DependencyData const& dp ) { return dp.name == "Result"; }
-			);
-			assert( it != vkData->dependencies.end() );
-			_writeTypeEnum( ofs.hdr(), *it, vkData->enums.find( it->name )->second );
-			_writeEnumsToString( ofs, *it, vkData->enums.find( it->name )->second );
-			vkData->dependencies.erase( it );
-
-			ofs.hdr() << exceptionHeader
-					  << "} // namespace vk\n\n"
-					  << isErrorCode
-					  << "\nnamespace vk\n"
-					  << "{\n"
-					  << resultValueHeader
-					  << createResultValueHeader;
-
-			_writeTypes( ofs, vkData, defaultValues );
-			_writeEnumsToString( ofs, vkData );
-
-			ofs << "} // namespace vk\n";
-			ofs.hdr() << "#endif // " << opt.includeGuard << std::endl;
-		}
-		catch( const std::exception& e )
-		{
-			std::cerr << "caught exception: " << e.what() << std::endl;
-			return -1;
-		}
-		catch( ... )
-		{
-			std::cerr << "caught unknown exception" << std::endl;
-			return -1;
-		}
-
-		return 0;
-	}
-	//--------------------------------------------------------------------------
-	void CppGenerator::_enterProtect( DualOFStream& ofs,
-									  std::string const& protect ) const
-	{
-		if( !protect.empty() )
-			ofs << "#ifdef " << protect << std::endl;
-	}
-	//--------------------------------------------------------------------------
-	void CppGenerator::_leaveProtect( DualOFStream& ofs,
-									  std::string const& protect ) const
-	{
-		if( !protect.empty() )
-			ofs << "#endif /*" << protect << "*/" << std::endl;
-	}
-	//--------------------------------------------------------------------------
-	void CppGenerator::_enterProtect( std::ofstream& ofs,
-									  std::string const& protect ) const
-	{
-		if( !protect.empty() )
-			ofs << "#ifdef " << protect << std::endl;
-	}
-	//--------------------------------------------------------------------------
-	void CppGenerator::_leaveProtect( std::ofstream& ofs,
-									  std::string const& protect ) const
-	{
-		if( !protect.empty() )
-			ofs << "#endif /*" << protect << "*/" << std::endl;
-	}
-	//--------------------------------------------------------------------------
-	std::string CppGenerator::_determineFunctionName( std::string const& name,
-													  CommandData const& commandData ) const
-	{
-		if( commandData.handleCommand )
-		{
-			std::string strippedName = name;
-			std::string searchName = commandData.arguments[ 0 ].pureType;
-			size_t pos = name.find( searchName );
-			if( pos == std::string::npos )
-			{
-				assert( isupper( searchName[ 0 ] ) );
-				searchName[ 0 ] = tolower( searchName[ 0 ] );
-				pos = name.find( searchName );
-			}
-			if( pos != std::string::npos )
-				strippedName.erase( pos, commandData.arguments[ 0 ].pureType.length() );
-
-			else if( commandData.arguments[ 0 ].pureType == "CommandBuffer"
-					 && name.find( "cmd" ) == 0 )
-			{
-				strippedName.erase( 0, 3 );
-				pos = 0;
-			}
-			if( pos == 0 )
-			{
-				assert( isupper( strippedName[ 0 ] ) );
-				strippedName[ 0 ] = tolower( strippedName[ 0 ] );
-			}
-			return strippedName;
-		}
-		return name;
-	}
-	//--------------------------------------------------------------------------
-	std::string CppGenerator::_determineReturnType( CommandData const& commandData,
-													size_t returnIndex,
-													bool isVector ) const
-	{
-		std::string returnType;
-		if( returnIndex != ~0
-			&& ( commandData.returnType == "void"
-				 || ( commandData.returnType == "Result"
-					  && ( commandData.successCodes.size() == 1
-						   || ( commandData.successCodes.size() == 2
-								&& commandData.successCodes[ 1 ] == "eIncomplete"
-								&& commandData.twoStep ) ) ) ) )
-		{
-			if( isVector )
-			{
-				if( commandData.arguments[ returnIndex ].pureType == "void" )
-					returnType = "std::vector<uint8_t, Allocator>";
-
-				else
-					returnType = "std::vector<" + commandData.arguments[ returnIndex ].pureType + ", Allocator>";
-			}
-			else
-			{
-				assert( commandData.arguments[ returnIndex ].type.back() == '*' );
-				assert( commandData.arguments[ returnIndex ].type.find( "const" ) == std::string::npos );
-				returnType = commandData.arguments[ returnIndex ].type;
-				returnType.pop_back();
-			}
-		}
-		else if( commandData.returnType == "Result" && commandData.successCodes.size() == 1 )
-		{
-			// an original return of type "Result" with less just one successCode is changed to void, errors throw an exception
-			returnType = "void";
-		}
-		else
-		{
-			// the return type just stays the original return type
-			returnType = commandData.returnType;
-		}
-		return returnType;
-	}
-	//--------------------------------------------------------------------------
-	std::string CppGenerator::_reduceName( std::string const& name ) const
-	{
-		std::string reducedName;
-		if( name[ 0 ] == 'p' && 1 < name.length() && ( isupper( name[ 1 ] ) || name[ 1 ] == 'p' ) )
-		{
-			reducedName = StringsHelper::strip( name, "p" );
-			reducedName[ 0 ] = tolower( reducedName[ 0 ] );
-		}
-		else
-			reducedName = name;
-
-		return reducedName;
-	}
-	//--------------------------------------------------------------------------
-	size_t CppGenerator::_findReturnIndex( CommandData const& commandData,
-										   std::map<size_t, size_t> const& vectorParameters ) const
-	{
-		if( commandData.returnType == "Result" || commandData.returnType == "void" )
-		{
-			for( size_t i = 0; i < commandData.arguments.size(); i++ )
-			{
-				if( commandData.arguments[ i ].type.find( '*' ) != std::string::npos
-					&& commandData.arguments[ i ].type.find( "const" ) == std::string::npos
-					&& !_isVectorSizeParameter( vectorParameters, i )
-					&& ( vectorParameters.find( i ) == vectorParameters.end()
-						 || commandData.twoStep
-						 || commandData.successCodes.size() == 1 ) )
-				{
-	#if !defined(NDEBUG)
-					for( size_t j = i + 1; j < commandData.arguments.size(); j++ )
-					{
-						assert( commandData.arguments[ j ].type.find( '*' ) == std::string::npos
-								|| commandData.arguments[ j ].type.find( "const" ) != std::string::npos );
-					}
-	#endif
-					return i;
-				}
-			}
-		}
-		return ~0;
-	}
-	//--------------------------------------------------------------------------
-	size_t CppGenerator::_findTemplateIndex( CommandData const& commandData,
-											 std::map<size_t, size_t> const& vectorParameters ) const
-	{
-		for( size_t i = 0; i < commandData.arguments.size(); i++ )
-		{
-			if( commandData.arguments[ i ].name == "pData"
-				|| commandData.arguments[ i ].name == "pValues" )
-			{
-				assert( vectorParameters.find( i ) != vectorParameters.end() );
-				return i;
-			}
-		}
-		return ~0;
-	}
-	//--------------------------------------------------------------------------
-	std::map<size_t, size_t> CppGenerator::_getVectorParameters( CommandData const& commandData ) const
-	{
-		std::map<size_t, size_t> lenParameters;
-		for( size_t i = 0; i < commandData.arguments.size(); i++ )
-		{
-			if( !commandData.arguments[ i ].len.empty() )
-			{
-				lenParameters.insert( std::make_pair( i, ~0 ) );
-				for( size_t j = 0; j < commandData.arguments.size(); j++ )
-				{
-					if( commandData.arguments[ i ].len == commandData.arguments[ j ].name )
-						lenParameters[ i ] = j;
-				}
-				assert( lenParameters[ i ] != ~0
-					|| commandData.arguments[ i ].len == "dataSize/4"
-					|| commandData.arguments[ i ].len == "latexmath:[$dataSize \\over 4$]"
-					|| commandData.arguments[ i ].len == "null-terminated"
-					|| commandData.arguments[ i ].len == "pAllocateInfo->descriptorSetCount"
-					|| commandData.arguments[ i ].len == "pAllocateInfo->commandBufferCount" );
-				assert( lenParameters[ i ] == ~0 || lenParameters[ i ] < i );
-			}
-		}
-		return lenParameters;
-	}
-	//--------------------------------------------------------------------------
-	bool CppGenerator::_hasPointerArguments( CommandData const& commandData ) const
-	{
-		for( size_t i = 0; i < commandData.arguments.size(); i++ )
-		{
-			size_t pos = commandData.arguments[ i ].type.find( '*' );
-			if( pos != std::string::npos &&
-				commandData.arguments[ i ].type.find( '*', pos + 1 ) == std::string::npos )
-				return true;
-		}
-		return false;
-	}
-	//--------------------------------------------------------------------------
-	bool CppGenerator::_isVectorSizeParameter( std::map<size_t, size_t> const& vectorParameters,
-											   size_t idx ) const
-	{
-		for( auto& it : vectorParameters )
-		{
-			if( it.second == idx )
-				return true;
-		}
-		return false;
-	}
-	//--------------------------------------------------------------------------
-	void CppGenerator::_sortDependencies( std::list<DependencyData>& dependencies ) const
-	{
-		std::set<std::string> listedTypes = { "VkFlags" };
-		std::list<DependencyData> sortedDependencies;
-
-		while( !dependencies.empty() )
-		{
-	#if !defined(NDEBUG)
-			bool ok = false;
-	#endif
-			for( auto it = dependencies.begin(); it != dependencies.end(); ++it )
-			{
-				if( _noDependencies( it->dependencies, listedTypes ) )
-				{
-					sortedDependencies.push_back( *it );
-					listedTypes.insert( it->name );
-					dependencies.erase( it );
-	#if !defined(NDEBUG)
-					ok = true;
-	#endif
-					break;
-				}
-			}
-			assert( ok );
-		}
-
-		dependencies.swap( sortedDependencies );
-	}
-	//--------------------------------------------------------------------------
-	bool CppGenerator::_noDependencies( std::set<std::string> const& dependencies,
-										std::set<std::string>& listedTypes ) const
-	{
-		for( auto& it : dependencies )
-		{
-			if( listedTypes.find( it ) == listedTypes.end() )
-				return false;
-		}
-
-		return true;
-	}
-	//--------------------------------------------------------------------------
-	void CppGenerator::_createDefaults( SpecData* vkData,
-										std::map<std::string, std::string>& defaultValues ) const
-	{
-		for( auto& it : vkData->dependencies )
-		{
-			assert( defaultValues.find( it.name ) == defaultValues.end() );
-			switch( it.category )
-			{
-				case DependencyData::Category::COMMAND:    // commands should never be asked for defaults
-					break;
-
-				case DependencyData::Category::ENUM:
-				{
-					assert( vkData->enums.find( it.name ) != vkData->enums.end() );
-					auto& enumData = vkData->enums.find( it.name )->second;
-					auto value = it.name;
-
-					if( !enumData.members.empty() )
-						value += "::" + vkData->enums.find( it.name )->second.members.front().name;
-					else
-						value += "()";
-
-					defaultValues[ it.name ] = value;
-				}
-				break;
-
-				case DependencyData::Category::FLAGS:
-				case DependencyData::Category::HANDLE:
-				case DependencyData::Category::STRUCT:
-				case DependencyData::Category::UNION:        // just call the default constructor for flags, structs, and structs (which are mapped to classes)
-					defaultValues[ it.name ] = it.name + "()";
-					break;
-
-				case DependencyData::Category::FUNC_POINTER: // func_pointers default to nullptr
-					defaultValues[ it.name ] = "nullptr";
-					break;
-
-				case DependencyData::Category::REQUIRED:     // all required default to "0"
-				case DependencyData::Category::SCALAR:       // all scalars default to "0"
-					defaultValues[ it.name ] = "0";
-					break;
-
-				default:
-					assert( false );
-					break;
-			}
-		}
-	}
-	//--------------------------------------------------------------------------
-	void CppGenerator::_writeVersionCheck( std::ofstream& ofs,
-										  std::string const& version ) const
-	{
-		ofs << "static_assert( VK_HEADER_VERSION == " << version
-			<< ", \"Wrong VK_HEADER_VERSION!\" );\n\n";
-	}
-	//--------------------------------------------------------------------------
-	void CppGenerator::_writeTypesafeCheck( std::ofstream& ofs,
-											std::string const& typesafeCheck ) const
-	{
-		ofs << "// 32-bit vulkan is not typesafe for handles, so don't allow copy constructors on this platform by default.\n"
-			<< "// To enable this feature on 32-bit platforms please define VK_CPP_TYPESAFE_CONVERSION\n"
-			<< typesafeCheck << std::endl
-			<< "#define VK_CPP_TYPESAFE_CONVERSION 1\n"
-			<< "#endif\n\n";
-	}
-	//--------------------------------------------------------------------------
-	void CppGenerator::_writeEnumsToString( DualOFStream& ofs, SpecData* vkData )
-	{
-		for( auto& it : vkData->dependencies )
-		{
-			switch( it.category )
-			{
-				case DependencyData::Category::ENUM:
-				{
-					assert( vkData->enums.find( it.name ) != vkData->enums.end() );
-					_writeEnumsToString(
-								ofs,
-								it,
-								vkData->enums.find( it.name )->second
-					);
-				}
-				break;
-
-				case DependencyData::Category::FLAGS:
-					_writeFlagsToString(
-								ofs,
-								it,
-								vkData->enums.find( *it.dependencies.begin() )->second
-					);
-				break;
-			}
-		}
-	}
-	//--------------------------------------------------------------------------
-	void CppGenerator::_writeEnumsToString( DualOFStream& ofs,
-											DependencyData const& dependencyData,
-											EnumData const& enumData )
-	{
-		_enterProtect( ofs, enumData.protect );
-		ofs << _indent;
-		if( !ofs.usingDualStream() )
-			ofs << "inline ";
-
-		ofs << "std::string to_string( " << dependencyData.name
-			<< ( enumData.members.empty() ? " )" : " value )" );
-		if( ofs.usingDualStream() )
-			ofs.hdr() << ";";
-
-		ofs << std::endl;
-		ofs.src() << _indent << "{\n";
-
-		if( enumData.members.empty() )
-			ofs.src() << ++_indent << "return \"(void)\";\n";
-		else
-		{
-			ofs.src() << ++_indent << "switch( value )\n" << _indent << "{\n";
-			for( auto& itMember : enumData.members )
-			{
-				ofs.src() << _indent << "case " << dependencyData.name << "::"
-					<< itMember.name << ": return \""
-					<< itMember.name.substr( 1 ) << "\";\n";
-			}
-			ofs.src() << _indent << "default: return \"invalid\";\n" << _indent
-					  << "}\n";
-		}
-		ofs.src() << --_indent << "}\n";
-		_leaveProtect( ofs, enumData.protect );
-		ofs << std::endl;
-	}
-	//--------------------------------------------------------------------------
-	void CppGenerator::_writeFlagsToString( DualOFStream& ofs,
-											DependencyData const& dependencyData,
-											EnumData const &enumData )
-	{
-		_enterProtect( ofs, enumData.protect );
-		ofs << _indent;
-		if( !ofs.usingDualStream() )
-			ofs << "inline ";
-
-		ofs << "std::string to_string( const " << dependencyData.name
-			<< ( enumData.members.empty() ? "& )" : "& value )" );
-
-		if( ofs.usingDualStream() )
-			ofs.hdr() << ";";
-
-		ofs << std::endl;
-		ofs.src() << _indent << "{\n";
-
-		if( enumData.members.empty() )
-			ofs.src() << ++_indent << "return \"{}\";\n";
-		else
-		{
-			std::string enumPrefix = *dependencyData.dependencies.begin() + "::";
-
-			ofs.src() << ++_indent << "if( !value ) return \"{}\";\n"
-					  << _indent << "std::string result;\n";
-
-			for( auto& itMember : enumData.members )
-			{
-				ofs.src() << _indent << "if( value & " << enumPrefix + itMember.name
-						  << " ) result += \"" << itMember.name.substr( 1 )
-						  << " | \";\n";
-			}
-
-			ofs.src() << _indent << "return \"{\" + result.substr( 0, result.size() - 3 ) + \"}\";\n";
-		}
-		ofs.src() << --_indent << "}\n";
-		_leaveProtect( ofs, enumData.protect );
-		ofs << std::endl;
-	}
-	//--------------------------------------------------------------------------
-	void CppGenerator::_writeTypes( DualOFStream& ofs, SpecData* vkData,
-									std::map<std::string, std::string> const& defaultValues )
-	{
-		for( auto& it : vkData->dependencies )
-		{
-			switch( it.category )
-			{
-				case DependencyData::Category::COMMAND:
-					_writeTypeCommand( ofs.hdr(), vkData, it );
-					break;
-
-				case DependencyData::Category::ENUM:
-					assert( vkData->enums.find( it.name ) != vkData->enums.end() );
-					_writeTypeEnum( ofs.hdr(), it, vkData->enums.find( it.name )->second );
-					break;
-
-				case DependencyData::Category::FLAGS:
-					assert( vkData->flags.find( it.name ) != vkData->flags.end() );
-					_writeTypeFlags( ofs, it, vkData->flags.find( it.name )->second );
-					break;
-
-				case DependencyData::Category::FUNC_POINTER:
-				case DependencyData::Category::REQUIRED:
-					// skip FUNC_POINTER and REQUIRED, they just needed to be in the dependencies list to resolve dependencies
-					break;
-
-				case DependencyData::Category::HANDLE:
-					assert( vkData->handles.find( it.name ) != vkData->handles.end() );
-					_writeTypeHandle( ofs, vkData, it, vkData->handles.find( it.name )->second, vkData->dependencies );
-					break;
-
-				case DependencyData::Category::SCALAR:
-					_writeTypeScalar( ofs.hdr(), it );
-					break;
-
-				case DependencyData::Category::STRUCT:
-					_writeTypeStruct( ofs, vkData, it, defaultValues );
-					break;
-
-				case DependencyData::Category::UNION:
-					assert( vkData->structs.find( it.name ) != vkData->structs.end() );
-					_writeTypeUnion( ofs, vkData, it, vkData->structs.find( it.name )->second, defaultValues );
-					break;
-
-				default:
-					assert( false );
-					break;
-			}
-		}
-	}
-	//--------------------------------------------------------------------------
-	void CppGenerator::_writeTypeCommand( std::ofstream& ofs, SpecData* vkData,
-										  DependencyData const& dependencyData ) const
-	{
-		auto it = vkData->commands.find( dependencyData.name );
-		assert( it != vkData->commands.end() );
-		auto& commandData = it->second;
-		if( !commandData.handleCommand )
-		{
-			_writeTypeCommandStandard( ofs, dependencyData.name, dependencyData, commandData, vkData->vkTypes );
-
-			ofs << "\n#ifndef VKCPP_DISABLE_ENHANCED_MODE\n";
-			_writeTypeCommandEnhanced( ofs, vkData, "", dependencyData.name, dependencyData, commandData );
-			ofs << "#endif /*VKCPP_DISABLE_ENHANCED_MODE*/\n\n";
-		}
-	}
-	//--------------------------------------------------------------------------
-	void CppGenerator::_writeTypeCommandStandard( std::ofstream& ofs,
-												  std::string const& functionName,
-												  DependencyData const& dependencyData,
-												  CommandData const& commandData,
-												  std::set<std::string> const& vkTypes ) const
-	{
-		_enterProtect( ofs, commandData.protect );
-		ofs << _indent;
-		if( !commandData.handleCommand )
-			ofs << "inline ";
-
-		ofs << commandData.returnType << " " << functionName << "( ";
-		bool argEncountered = false;
-		for( size_t i = commandData.handleCommand ? 1 : 0; i < commandData.arguments.size(); i++ )
-		{
-			if( argEncountered )
-				ofs << ", ";
-
-			ofs << commandData.arguments[ i ].type << " " << commandData.arguments[ i ].name;
-			if( !commandData.arguments[ i ].arraySize.empty() )
-				ofs << "[ " << commandData.arguments[ i ].arraySize << " ]";
-
-			argEncountered = true;
-		}
-		ofs << " )";
-		if( commandData.handleCommand )
-			ofs << " const";
-
-		ofs << std::endl << _indent << "{\n" << _indent << "  ";
-
-		bool castReturn = false;
-		if( commandData.returnType != "void" )
-		{
-			ofs << "return ";
-			castReturn = ( vkTypes.find( commandData.returnType ) != vkTypes.end() );
-			if( castReturn )
-				ofs << "static_cast<" << commandData.returnType << ">( ";
-		}
-
-		std::string callName( dependencyData.name );
-		assert( islower( callName[ 0 ] ) );
-		callName[ 0 ] = toupper( callName[ 0 ] );
-
-		ofs << "vk" << callName << "( ";
-		if( commandData.handleCommand )
-			ofs << "m_" << commandData.arguments[ 0 ].name;
-
-		argEncountered = false;
-		for( size_t i = commandData.handleCommand ? 1 : 0; i < commandData.arguments.size(); i++ )
-		{
-			if( 0 < i )
-				ofs << ", ";
-
-			_writeMemberData( ofs, commandData.arguments[ i ], vkTypes );
-		}
-		ofs << " )";
-		if( castReturn )
-			ofs << " )";
-
-		ofs << ";\n" << _indent << "}\n";
-		_leaveProtect( ofs, commandData.protect );
-	}
-	//--------------------------------------------------------------------------
-	void CppGenerator::_writeTypeCommandEnhanced( std::ofstream& ofs, SpecData* vkData,
-												  std::string const& className,
-												  std::string const& functionName,
-												  DependencyData const& dependencyData,
-												  CommandData const& commandData ) const
-	{
-		_enterProtect( ofs, commandData.protect );
-		std::map<size_t, size_t> vectorParameters = _getVectorParameters( commandData );
-		size_t returnIndex = _findReturnIndex( commandData, vectorParameters );
-		size_t templateIndex = _findTemplateIndex( commandData, vectorParameters );
-		auto returnVector = vectorParameters.find( returnIndex );
-		std::string returnType = _determineReturnType( commandData, returnIndex, returnVector != vectorParameters.end() );
-
-		_writeFunctionHeader( ofs, vkData, returnType, functionName, commandData, returnIndex, templateIndex, vectorParameters );
-		_writeFunctionBody( ofs, className, functionName, returnType, templateIndex, dependencyData, commandData, vkData->vkTypes, returnIndex, vectorParameters );
-		_leaveProtect( ofs, commandData.protect );
-	}
-	//--------------------------------------------------------------------------
-	void CppGenerator::_writeTypeEnum( std::ofstream& ofs,
-									   DependencyData const& dependencyData,
-									   EnumData const& enumData )
-	{
-		_enterProtect( ofs, enumData.protect );
-		ofs << _indent << "enum class " << dependencyData.name;
-		if( enumData.members.empty() )
-			ofs << " {};\n";
-		else
-		{
-			ofs << "\n" << _indent << "{\n";
-			++_indent;
-			for( size_t i = 0; i < enumData.members.size(); i++ )
-			{
-				ofs << _indent << enumData.members[ i ].name << " = "
-					<< enumData.members[ i ].value << std::endl;
-			}
-			ofs << --_indent << "};\n";
-		}
-		_leaveProtect( ofs, enumData.protect );
-		ofs << std::endl;
-	}
-	//--------------------------------------------------------------------------
-	void CppGenerator::_writeTypeFlags( DualOFStream& ofs,
-										DependencyData const& dependencyData,
-										FlagData const& flagData )
-	{
-		assert( dependencyData.dependencies.size() == 1 );
-		_enterProtect( ofs, flagData.protect );
-		auto& firstDep = *dependencyData.dependencies.begin();
-		auto& depName = dependencyData.name;
-
-		ofs.hdr() << _indent
-				  << "using " << depName << " = Flags<" << firstDep
-				  << ", Vk" << depName << ">;\n\n";
-
-		ofs << _indent;
-		if( !ofs.usingDualStream() )
-			ofs << "inline ";
-
-		ofs << depName << " operator|( " << firstDep << " bit0, " << firstDep << " bit1 )";
-		if( ofs.usingDualStream() )
-			ofs.hdr() << ";";
-
-		ofs << std::endl;
-		ofs.src() << _indent << "{\n";
-		ofs.src() << _indent + 1 << "return " << depName << "( bit0 ) | bit1;\n";
-		ofs.src() << _indent << "}\n";
-
-		_leaveProtect( ofs, flagData.protect );
-		ofs << std::endl;
-	}
-	//--------------------------------------------------------------------------
-	void CppGenerator::_writeTypeHandle( DualOFStream& ofs, SpecData* vkData,
-										 DependencyData const& dependencyData,
-										 HandleData const& handle,
-										 std::list<DependencyData> const& dependencies )
-	{
-		std::string memberName = dependencyData.name;
-		assert( isupper( memberName[ 0 ] ) );
-		memberName[ 0 ] = tolower( memberName[ 0 ] );
-
-		_writeComment( ofs.hdr(), dependencyData.name, "class" );
-		ofs.hdr() << _indent << "class " << dependencyData.name
-				  << "\n" << _indent << "{\n" << _indent << "public:\n";
-
-		ofs << ++_indent << dependencyData.name;
-
-		if( ofs.usingDualStream() )
-		{
-			ofs.hdr() << "();";
-			ofs.src() << "::" << dependencyData.name << "()";
-		}
-		else
-			ofs.hdr() << "()";
-
-		ofs << std::endl;
-		ofs.src() << ++_indent << ": m_" << memberName << "( VK_NULL_HANDLE )\n";
-		ofs.src() << --_indent << "{}\n\n";
-
-		ofs << "#ifdef VK_CPP_TYPESAFE_CONVERSION\n" << _indent;
-		// construct from native handle
-		if( ofs.usingDualStream() )
-			ofs.src() << dependencyData.name << "::";
-
-		ofs << dependencyData.name << "( Vk" << dependencyData.name << " " << memberName << " )";
-
-		if( ofs.usingDualStream() )
-			ofs.hdr() << ";";
-
-		ofs << std::endl;
-		ofs.src() << ++_indent << ": m_" << memberName << "( " << memberName << " )\n";
-		ofs.src() << --_indent << "{}\n\n";
-
-		// assignment from native handle
-		ofs << _indent << dependencyData.name << "& ";
-		if( ofs.usingDualStream() )
-			ofs.src() << dependencyData.name << "::";
-
-		ofs << "operator=( Vk" << dependencyData.name << " " << memberName << " )";
-
-		if( ofs.usingDualStream() )
-			ofs.hdr() << ";";
-
-		ofs << std::endl;
-		ofs.src() << _indent << "{\n";
-		ofs.src() << ++_indent << "m_" << memberName << " = " << memberName << ";\n"
-				  << _indent << "return *this;\n";
-		ofs.src() << --_indent << "}\n";
-
-		ofs.hdr() << "#else\n";
-
-		ofs.hdr() << _indent << "explicit\n";
-		ofs << ( _indent -= 2 ) << "#endif\n";
-
-		ofs << ( _indent += 2 );
-		if( ofs.usingDualStream() )
-			ofs.src() << dependencyData.name << "::";
-
-		ofs << "operator Vk" << dependencyData.name << "() const";
-		if( ofs.usingDualStream() )
-			ofs.hdr() << ";";
-
-		ofs << std::endl;
-		ofs.src() << _indent << "{\n";
-		ofs.src() << ++_indent << "return m_" << memberName << ";\n";
-		ofs.src() << --_indent << "}\n\n";
-
-		if( !handle.commands.empty() )
-		{
-			for( size_t i = 0; i < handle.commands.size(); i++ )
-			{
-				std::string commandName = handle.commands[ i ];
-				auto cit = vkData->commands.find( commandName );
-				assert( cit != vkData->commands.end() && cit->second.handleCommand );
-				auto dep = std::find_if(
-							dependencies.begin(),
-							dependencies.end(),
-							[ commandName ]( DependencyData const& dd ) { return dd.name == commandName; }
-				);
-				assert( dep != dependencies.end() );
-				std::string className = dependencyData.name;
-				std::string functionName = _determineFunctionName( dep->name, cit->second );
-
-				bool hasPointers = _hasPointerArguments( cit->second );
-				if( !hasPointers )
-					ofs << "#ifdef VKCPP_DISABLE_ENHANCED_MODE\n";
-
-				_writeTypeCommandStandard( ofs.hdr(), functionName, *dep, cit->second, vkData->vkTypes );
-				if( !hasPointers )
-					ofs << "#endif /*!VKCPP_DISABLE_ENHANCED_MODE*/\n";
-
-				ofs << "\n#ifndef VKCPP_DISABLE_ENHANCED_MODE\n";
-				_writeTypeCommandEnhanced( ofs.hdr(), vkData, className, functionName, *dep, cit->second );
-				ofs << "#endif /*VKCPP_DISABLE_ENHANCED_MODE*/\n";
-
-				if( i < handle.commands.size() - 1 )
-					ofs << std::endl;
-			}
-			ofs << std::endl;
-		}
-
-		ofs.hdr() << _indent << "explicit ";
-		if( ofs.usingDualStream() )
-			ofs.src() << _indent << dependencyData.name << "::";
-
-		ofs << "operator bool() const";
-		if( ofs.usingDualStream() )
-			ofs.hdr() << ";";
-
-		ofs << std::endl;
-		ofs.src() << _indent << "{\n";
-		ofs.src() << ++_indent << "return m_" << memberName << " != VK_NULL_HANDLE;\n";
-		ofs.src() << --_indent << "}\n\n";
-
-		ofs << _indent << "bool ";
-		if( ofs.usingDualStream() )
-			ofs.src() << dependencyData.name << "::";
-
-		ofs << "operator!() const";
-		if( ofs.usingDualStream() )
-			ofs.hdr() << ";";
-
-		ofs << std::endl;
-		ofs.src() << _indent  << "{\n";
-		ofs.src() << ++_indent << "return m_" << memberName << " == VK_NULL_HANDLE;\n";
-		ofs.src() << --_indent << "}\n\n";
-
-		ofs.hdr() << --_indent << "private:\n";
-		ofs.hdr() << _indent + 1 << "Vk" << dependencyData.name << " m_" << memberName << ";\n";
-		ofs.hdr() << _indent << "};\n";
-	#if 1
-		ofs.src() << _indent << "static_assert( sizeof( " << dependencyData.name
-				  << " ) == sizeof( Vk" << dependencyData.name
-				  << " ), \"handle and wrapper have different size!\" );\n";
-	#endif
-		ofs << std::endl;
-	}
-	//--------------------------------------------------------------------------
-	void CppGenerator::_writeTypeScalar( std::ofstream& ofs,
-										 DependencyData const& dependencyData ) const
-	{
-		assert( dependencyData.dependencies.size() == 1 );
-		ofs << _indent << "using " << dependencyData.name << " = "
-			<< *dependencyData.dependencies.begin() << ";\n\n";
-	}
-	//--------------------------------------------------------------------------
-	void CppGenerator::_writeTypeStruct( DualOFStream& ofs, SpecData* vkData,
-										 DependencyData const& dependencyData,
-										 std::map<std::string, std::string> const& defaultValues )
-	{
-		auto it = vkData->structs.find( dependencyData.name );
-		assert( it != vkData->structs.end() );
-
-		_enterProtect( ofs, it->second.protect );
-
-		_writeComment( ofs.hdr(), dependencyData.name, "struct" );
-		ofs.hdr() << _indent << "struct " << dependencyData.name << std::endl
-			<< _indent << "{\n";
-
-		// only structs that are not returnedOnly get a constructor!
-		if( !it->second.returnedOnly )
-		{
-			_writeStructConstructor(
-						ofs,
-						dependencyData.name,
-						it->second,
-						vkData->vkTypes,
-						defaultValues
-			);
-		}
-
-		// create the setters
-		if( !it->second.returnedOnly )
-		{
-			for( size_t i = 0; i < it->second.members.size(); i++ )
-			{
-				_writeStructSetter(
-							ofs,
-							dependencyData.name,
-							it->second.members[ i ],
-							vkData->vkTypes
-				);
-			}
-		}
-
-		// the cast-operator to the wrapped struct
-		ofs << ++_indent;
-		if( ofs.usingDualStream() )
-			ofs.src() << dependencyData.name << "::";
-
-		ofs << "operator const Vk" << dependencyData.name << "&() const";
-
-		if( ofs.usingDualStream() )
-			ofs.hdr() << ";";
-
-		ofs << std::endl;
-		ofs.src() << _indent << "{\n"
-				  << _indent + 1 << "return *reinterpret_cast<const Vk"
-				  << dependencyData.name << "*>( this );\n" << _indent << "}\n\n";
-
-		// the member variables
-		for( size_t i = 0; i < it->second.members.size(); i++ )
-		{
-			if( it->second.members[ i ].type == "StructureType" )
-			{
-				assert( i == 0 && it->second.members[ i ].name == "sType" );
-				ofs.hdr() << _indent - 1 << "private:\n"
-					<< _indent << "StructureType sType;\n\n"
-					<< _indent - 1 << "public:\n";
-			}
-			else
-			{
-				ofs.hdr() << _indent << it->second.members[ i ].type << " "
-						  << it->second.members[ i ].name;
-
-				if( !it->second.members[ i ].arraySize.empty() )
-					ofs.hdr() << "[ " << it->second.members[ i ].arraySize << " ]";
-
-				ofs.hdr() << ";\n";
-			}
-		}
-		ofs.hdr() << --_indent << "};\n";
-	#if 1
-		ofs.src() << _indent << "static_assert( sizeof( " << dependencyData.name
-			<< " ) == sizeof( Vk" << dependencyData.name
-			<< " ), \"struct and wrapper have different size!\" );" << std::endl;
-	#endif
-		_leaveProtect( ofs, it->second.protect );
-		ofs << std::endl;
-	}
-	//--------------------------------------------------------------------------
-	void CppGenerator::_writeTypeUnion( DualOFStream& ofs, SpecData* vkData,
-										DependencyData const& dependencyData,
-										StructData const& unionData,
-										std::map<std::string, std::string> const& defaultValues )
-	{
-		//Unused variable
-		//std::ostringstream oss;
-		_writeComment( ofs.hdr(), dependencyData.name, "union" );
-		ofs.hdr() << _indent << "union " << dependencyData.name << std::endl
-			<< _indent << "{\n";
-
-		++_indent;
-		for( size_t i = 0; i < unionData.members.size(); i++ )
-		{
-			ofs << _indent;
-
-			// one constructor per union element
-			if( ofs.usingDualStream() )
-				ofs.src() << dependencyData.name << "::";
-
-			ofs << dependencyData.name << "( ";
-			if( unionData.members[ i ].arraySize.empty() )
-				ofs << unionData.members[ i ].type << " ";
-
-			else
-				ofs << "const std::array<" << unionData.members[ i ].type << ", " << unionData.members[ i ].arraySize << ">& ";
-
-			ofs << unionData.members[ i ].name << "_";
-
-			// just the very first constructor gets default arguments
-			if( i == 0 )
-			{
-				auto it = defaultValues.find( unionData.members[ i ].pureType );
-				assert( it != defaultValues.end() );
-				if( unionData.members[ i ].arraySize.empty() )
-					ofs.hdr() << " = " << it->second;
-				else
-					ofs.hdr() << " = { " << it->second << " }";
-			}
-			ofs << " )";
-
-			if( ofs.usingDualStream() )
-				ofs.hdr() << ";";
-
-			ofs << std::endl;
-			ofs.src() << _indent << "{\n";
-			ofs.src() << _indent + 1;
-
-			if( unionData.members[ i ].arraySize.empty() )
-				ofs.src() << unionData.members[ i ].name << " = " << unionData.members[ i ].name << "_";
-			else
-			{
-				ofs.src() << "memcpy( &" << unionData.members[ i ].name << ", "
-						  << unionData.members[ i ].name << "_.data(), "
-						  << unionData.members[ i ].arraySize
-						  << " * sizeof( " << unionData.members[ i ].type << " ) )";
-			}
-			ofs.src() << ";\n" <<_indent << "}\n\n";
-		}
-
-		for( size_t i = 0; i < unionData.members.size(); i++ )
-		{
-			// one setter per union element
-			assert( !unionData.returnedOnly );
-			_writeStructSetter( ofs, dependencyData.name, unionData.members[ i ], vkData->vkTypes );
-		}
-
-		// the implicit cast operator to the native type
-		ofs << _indent;
-		if( ofs.usingDualStream() )
-			ofs.src() << dependencyData.name << "::";
-
-		ofs << "operator Vk" << dependencyData.name << " const& () const";
-
-		if( ofs.usingDualStream() )
-			ofs.hdr() << ";";
-
-		ofs << std::endl;
-		ofs.src() << _indent << "{\n"
-				  << _indent + 1 << "return *reinterpret_cast<const Vk" << dependencyData.name << "*>( this );\n"
-				  << _indent << "}\n\n";
-
-		// the union member variables
-		// if there's at least one Vk... type in this union, check for unrestricted unions support
-		bool needsUnrestrictedUnions = false;
-		for( size_t i = 0; i < unionData.members.size() && !needsUnrestrictedUnions; i++ )
-			needsUnrestrictedUnions = vkData->vkTypes.find( unionData.members[ i ].type ) != vkData->vkTypes.end();
-
-		if( needsUnrestrictedUnions )
-		{
-			ofs.hdr() << "#ifdef VK_CPP_HAS_UNRESTRICTED_UNIONS\n";
-			for( size_t i = 0; i < unionData.members.size(); i++ )
-			{
-				ofs.hdr() << _indent << unionData.members[ i ].type << " " << unionData.members[ i ].name;
-				if( !unionData.members[ i ].arraySize.empty() )
-					ofs.hdr() << "[ " << unionData.members[ i ].arraySize << " ]";
-
-				ofs.hdr() << ";\n";
-			}
-			ofs.hdr() << "#else\n";
-		}
-		for( size_t i = 0; i < unionData.members.size(); i++ )
-		{
-			ofs.hdr() << _indent;
-			if( vkData->vkTypes.find( unionData.members[ i ].type ) != vkData->vkTypes.end() )
-				ofs.hdr() << "Vk";
-
-			ofs.hdr() << unionData.members[ i ].type << " " << unionData.members[ i ].name;
-			if( !unionData.members[ i ].arraySize.empty() )
-				ofs.hdr() << "[ " << unionData.members[ i ].arraySize << " ]";
-
-			ofs.hdr() << ";\n";
-		}
-		if( needsUnrestrictedUnions )
-			ofs.hdr() << "#endif // VK_CPP_HAS_UNRESTRICTED_UNIONS\n";
-
-		ofs.hdr() << --_indent << "};\n\n";
-	}
-	//--------------------------------------------------------------------------
-	void CppGenerator::_writeStructConstructor( DualOFStream& ofs,
-												std::string const& name,
-												StructData const& structData,
-												std::set<std::string> const& /*vkTypes*/, //Unused variable
-												std::map<std::string,
-												std::string> const& defaultValues )
-	{
-		// the constructor with all the elements as arguments, with defaults
-		ofs << ++_indent;
-		if( ofs.usingDualStream() )
-			ofs.src() << name << "::";
-
-		ofs << name << "( ";
-		bool listedArgument = false;
-		for( size_t i = 0; i < structData.members.size(); i++ )
-		{
-			if( listedArgument )
-				ofs << ", ";
-
-			if( structData.members[ i ].name == "pNext"
-				|| structData.members[ i ].name == "sType" )
-				continue;
-
-			auto defaultIt = defaultValues.find( structData.members[ i ].pureType );
-			assert( defaultIt != defaultValues.end() );
-			if( structData.members[ i ].arraySize.empty() )
-			{
-				ofs << structData.members[ i ].type << " "
-					<< structData.members[ i ].name << "_";
-
-				ofs.hdr() << " = " << ( structData.members[ i ].type.back() == '*' ? "nullptr" : defaultIt->second );
-			}
-			else
-			{
-				ofs << "std::array<" << structData.members[ i ].type << ", "
-					<< structData.members[ i ].arraySize << "> const& "
-					<< structData.members[ i ].name << "_";
-
-				ofs.hdr() << " = { " << defaultIt->second;
-
-				size_t n = atoi( structData.members[ i ].arraySize.c_str() );
-				assert( 0 < n );
-				for( size_t j = 1; j < n; j++ )
-					ofs.hdr() << ", " << defaultIt->second;
-
-				ofs.hdr() << " }";
-			}
-			listedArgument = true;
-		}
-		ofs << " )";
-		if( ofs.usingDualStream() )
-			ofs.hdr() << ";";
-
-		ofs << std::endl;
-
-		// copy over the simple arguments
-		bool firstArgument = true;
-		++_indent;
-		for( size_t i = 0; i < structData.members.size(); i++ )
-		{
-			if( !structData.members[ i ].arraySize.empty() )
-				continue;
-
-			ofs.src() << _indent << ( firstArgument ? ": " : ", " ) << structData.members[ i ].name << "( ";
-			if( structData.members[ i ].name == "pNext" )
-				ofs.src() << "nullptr";
-
-			else if( structData.members[ i ].name == "sType" )
-				ofs.src() << "StructureType::e" << name;
-
-			else
-				ofs.src() << structData.members[ i ].name << "_";
-
-			ofs.src() << " )\n";
-			firstArgument = false;
-		}
-		--_indent;
-
-		// the body of the constructor, copying over data from argument list into wrapped struct
-		if( structData.members.empty() )
-			ofs.src() << _indent << "{}\n\n";
-		else
-		{
-			ofs.src() << _indent << "{\n";
-			++_indent;
-			for( size_t i = 0; i < structData.members.size(); i++ )
-			{
-				if( structData.members[ i ].arraySize.empty() )
-					continue;
-
-				ofs.src() << _indent << "memcpy( &" << structData.members[ i ].name
-						  << ", " << structData.members[ i ].name << "_.data(), "
-						  << structData.members[ i ].arraySize
-						  << " * sizeof( " << structData.members[ i ].type << " ) );\n";
-			}
-			ofs.src() << --_indent << "}\n\n";
-		}
-
-		// the copy constructor from a native struct (Vk...)
-		ofs << _indent;
-		if( ofs.usingDualStream() )
-			ofs.src() << name << "::";
-
-		ofs << name << "( Vk" << name << " const& rhs )";
-		if( ofs.usingDualStream() )
-			ofs.hdr() << ";";
-
-		ofs << std::endl;
-		ofs.src() << _indent << "{\n"
-				  << _indent + 1 << "memcpy( this, &rhs, sizeof( " << name << " ) );\n"
-				  << _indent << "}\n\n";
-
-		// the assignment operator from a native sturct (Vk...)
-		ofs << _indent << name << "& ";
-		if( ofs.usingDualStream() )
-			ofs.src() << name << "::";
-
-		ofs << "operator=( Vk" << name << " const& rhs )";
-		if( ofs.usingDualStream() )
-			ofs.hdr() << ";";
-
-		ofs << std::endl;
-		ofs.src() << _indent << "{\n"
-				  << _indent + 1 << "memcpy( this, &rhs, sizeof( " << name << " ) );\n"
-				  << _indent + 1 << "return *this;\n"
-				  << _indent << "}\n\n";
-
-		--_indent;
-	}
-	//--------------------------------------------------------------------------
-	void CppGenerator::_writeStructSetter( DualOFStream& ofs,
-										   std::string const& name,
-										   MemberData const& memberData,
-										   std::set<std::string> const& /*vkTypes*/ ) //Unused variable
-	{
-		ofs << ++_indent << name << "& ";
-
-		if( ofs.usingDualStream() )
-			ofs.src() << name << "::";
-
-		ofs << "set" << static_cast<char>( toupper( memberData.name[ 0 ] ) )
-			<< memberData.name.substr( 1 ) << "( ";
-
-		if( memberData.arraySize.empty() )
-			ofs << memberData.type << " ";
-
-		else
-			ofs << "const std::array<" << memberData.type << ", " << memberData.arraySize << ">& ";
-
-		ofs << memberData.name << "_ )";
-
-		if( ofs.usingDualStream() )
-			ofs.hdr() << ";";
-
-		ofs << std::endl;
-		ofs.src() << _indent << "{\n";
-
-		if( !memberData.arraySize.empty() )
-		{
-			ofs.src() << _indent + 1 << "memcpy( &" << memberData.name << ", "
-					  << memberData.name << "_.data(), " << memberData.arraySize
-					  << " * sizeof( " << memberData.type << " ) )";
-		}
-		else
-			ofs.src() << _indent + 1 << memberData.name << " = " << memberData.name << "_";
-
-		ofs.src() << ";\n" << _indent + 1 << "return *this;\n";
-		ofs.src() << _indent << "}\n\n";
-		--_indent;
-	}
-	//--------------------------------------------------------------------------
-	void CppGenerator::_writeMemberData( std::ofstream& ofs,
-										 MemberData const& memberData,
-										 std::set<std::string> const& vkTypes ) const
-	{
-		if( vkTypes.find( memberData.pureType ) != vkTypes.end() )
-		{
-			if( memberData.type.back() == '*' )
-			{
-				ofs << "reinterpret_cast<";
-				if( memberData.type.find( "const" ) == 0 )
-					ofs << "const ";
-
-				ofs << "Vk" << memberData.pureType << '*';
-			}
-			else
-				ofs << "static_cast<Vk" << memberData.pureType;
-
-			ofs << ">( " << memberData.name << " )";
-		}
-		else
-			ofs << memberData.name;
-	}
-	//--------------------------------------------------------------------------
-	void CppGenerator::_writeFunctionHeader( std::ofstream& ofs, SpecData* vkData,
-											 std::string const& returnType,
-											 std::string const& name,
-											 CommandData const& commandData,
-											 size_t returnIndex,
-											 size_t templateIndex,
-											 std::map<size_t, size_t> const& vectorParameters ) const
-	{
-		std::set<size_t> skippedArguments;
-		for( auto& it : vectorParameters )
-		{
-			if( it.second != ~0 )
-				skippedArguments.insert( it.second );
-		}
-		if( vectorParameters.size() == 1
-			&& ( commandData.arguments[ vectorParameters.begin()->first ].len == "dataSize/4"
-				 || commandData.arguments[ vectorParameters.begin()->first ].len == "latexmath:[$dataSize \\over 4$]" ) )
-		{
-			assert( commandData.arguments[ 3 ].name == "dataSize" );
-			skippedArguments.insert( 3 );
-		}
-		if( returnIndex != ~0 )
-			skippedArguments.insert( returnIndex );
-
-		ofs << _indent;
-		if( templateIndex != ~0 && ( templateIndex != returnIndex || returnType == "Result" ) )
-		{
-			assert( returnType.find( "Allocator" ) == std::string::npos );
-			ofs << "template <typename T>\n" << _indent;
-		}
-		else if( returnType.find( "Allocator" ) != std::string::npos )
-		{
-			assert( returnType.substr( 0, 12 ) == "std::vector<" && returnType.find( ',' ) != std::string::npos && 12 < returnType.find( ',' ) );
-			ofs << "template <typename Allocator = std::allocator<"
-				<< returnType.substr( 12, returnType.find( ',' ) - 12 ) << ">>\n"
-				<< _indent;
-
-			if( returnType != commandData.returnType && commandData.returnType != "void" )
-				ofs << "typename ";
-		}
-		else if( !commandData.handleCommand )
-			ofs << "inline ";
-
-		if( returnType != commandData.returnType && commandData.returnType != "void" )
-		{
-			assert( commandData.returnType == "Result" );
-			ofs << "ResultValueType<" << returnType << ">::type ";
-		}
-		else if( returnIndex != ~0 && 1 < commandData.successCodes.size() )
-		{
-			assert( commandData.returnType == "Result" );
-			ofs << "ResultValue<" << commandData.arguments[ returnIndex ].pureType << "> ";
-		}
-		else
-			ofs << returnType << " ";
-
-		ofs << _reduceName( name ) << "(";
-		if( skippedArguments.size() + ( commandData.handleCommand ? 1 : 0 ) < commandData.arguments.size() )
-		{
-			size_t lastArgument = ~0;
-			for( size_t i = commandData.arguments.size() - 1; i < commandData.arguments.size(); i-- )
-			{
-				if( skippedArguments.find( i ) == skippedArguments.end() )
-				{
-					lastArgument = i;
-					break;
-				}
-			}
-
-			ofs << " ";
-			bool argEncountered = false;
-			for( size_t i = commandData.handleCommand ? 1 : 0; i < commandData.arguments.size(); i++ )
-			{
-				if( skippedArguments.find( i ) == skippedArguments.end() )
-				{
-					if( argEncountered )
-						ofs << ", ";
-
-					auto it = vectorParameters.find( i );
-					size_t pos = commandData.arguments[ i ].type.find( '*' );
-					if( it == vectorParameters.end() )
-					{
-						if( pos == std::string::npos )
-						{
-							ofs << commandData.arguments[ i ].type << " " << _reduceName( commandData.arguments[ i ].name );
-							if( !commandData.arguments[ i ].arraySize.empty() )
-								ofs << "[ " << commandData.arguments[ i ].arraySize << " ]";
-
-							if( lastArgument == i )
-							{
-								auto flagIt = vkData->flags.find( commandData.arguments[ i ].pureType );
-								if( flagIt != vkData->flags.end() )
-								{
-									auto depIt = std::find_if( vkData->dependencies.begin(), vkData->dependencies.end(), [ &flagIt ]( DependencyData const& dd ) { return( dd.name == flagIt->first ); } );
-									assert( depIt != vkData->dependencies.end() );
-									assert( depIt->dependencies.size() == 1 );
-									auto enumIt = vkData->enums.find( *depIt->dependencies.begin() );
-									assert( enumIt != vkData->enums.end() );
-									if( enumIt->second.members.empty() )
-										ofs << " = " << commandData.arguments[ i ].pureType << "()";
-								}
-							}
-						}
-						else
-						{
-							assert( commandData.arguments[ i ].type[ pos ] == '*' );
-							auto n = _reduceName( commandData.arguments[ i ].name );
-
-							if( commandData.arguments[ i ].optional )
-							{
-								ofs << "Optional<"
-									<< StringsHelper::trimEnd( commandData.arguments[ i ].type.substr( 0, pos ) )
-									<< "> " << n << " = nullptr";
-							}
-							else if( commandData.arguments[ i ].type.find( "char" ) == std::string::npos )
-							{
-								ofs << StringsHelper::trimEnd( commandData.arguments[ i ].type.substr( 0, pos ) )
-									<< "& " << n;
-							}
-							else
-								ofs << "const std::string& " << n;
-						}
-					}
-					else
-					{
-						bool optional = commandData.arguments[ i ].optional && ( it == vectorParameters.end() || it->second == ~0 );
-						assert( pos != std::string::npos );
-						assert( commandData.arguments[ i ].type[ pos ] == '*' );
-						auto n = _reduceName( commandData.arguments[ i ].name );
-						if( commandData.arguments[ i ].type.find( "char" ) != std::string::npos )
-						{
-							if( optional )
-								ofs << "Optional<const std::string> " << n << " = nullptr";
-							else
-								ofs << "const std::string& " << n;
-						}
-						else
-						{
-							assert( !optional );
-							bool isConst = ( commandData.arguments[ i ].type.find( "const" ) != std::string::npos );
-							ofs << "ArrayProxy<" << ( templateIndex == i ? ( isConst ? "const T" : "T" ) : StringsHelper::trimEnd( commandData.arguments[ i ].type.substr( 0, pos ) ) ) << "> " << n;
-						}
-					}
-					argEncountered = true;
-				}
-			}
-			ofs << " ";
-		}
-		ofs << ")";
-		if( commandData.handleCommand )
-			ofs << " const";
-
-		ofs << std::endl;
-	}
-	//--------------------------------------------------------------------------
-	void CppGenerator::_writeFunctionBody( std::ofstream& ofs,
-										   std::string const& className,
-										   std::string const& functionName,
-										   std::string const& returnType,
-										   size_t templateIndex,
-										   DependencyData const& dependencyData,
-										   CommandData const& commandData,
-										   std::set<std::string> const& vkTypes,
-										   size_t returnIndex,
-										   std::map<size_t, size_t> const& vectorParameters ) const
-	{
-		ofs << _indent << "{\n";
-
-		// add a static_assert if a type is templated and its size needs to be some multiple of the original size
-		if( templateIndex != ~0 && commandData.arguments[ templateIndex ].pureType != "void" )
-		{
-			ofs << _indent << "  static_assert( sizeof( T ) % sizeof( "
-				<< commandData.arguments[ templateIndex ].pureType
-				<< " ) == 0, \"wrong size of template type T\" );\n";
-		}
-
-		// add some error checks if multiple vectors need to have the same size
-		if( 1 < vectorParameters.size() )
-		{
-			for( auto it0 = vectorParameters.begin(); it0 != vectorParameters.end(); ++it0 )
-			{
-				if( it0->first == returnIndex )
-					continue;
-
-				for( auto it1 = std::next( it0 ); it1 != vectorParameters.end(); ++it1 )
-				{
-					if( it1->first == returnIndex || it0->second != it1->second )
-						continue;
-
-					auto n0 = _reduceName( commandData.arguments[ it0->first ].name );
-					auto n1 = _reduceName( commandData.arguments[ it1->first ].name );
-
-					ofs << "#ifdef VK_CPP_NO_EXCEPTIONS\n"
-						<< _indent << "  assert( " << n0 << ".size() == " << n1 << ".size() );\n"
-						<< "#else\n"
-						<< _indent << "  if ( " << n0 << ".size() != " << n1 << ".size() )\n"
-						<< _indent << "  {\n"
-						<< _indent << "    throw std::logic_error( \"vk::"
-						<< className << "::" << functionName << ": " << n0 << ".size() != " << n1 << ".size()\" );\n"
-						<< _indent << "  }\n"
-						<< "#endif  // VK_CPP_NO_EXCEPTIONS\n";
-				}
-			}
-		}
-
-		// write the local variable to hold a returned value
-		if( returnIndex != ~0 )
-		{
-			if( commandData.returnType != returnType )
-			{
-				ofs << _indent << "  " << returnType << " "
-					<< _reduceName( commandData.arguments[ returnIndex ].name );
-
-				auto it = vectorParameters.find( returnIndex );
-				if( it != vectorParameters.end() && !commandData.twoStep )
-				{
-					std::string size;
-					if( it->second == ~0 && !commandData.arguments[ returnIndex ].len.empty() )
-					{
-						size = _reduceName( commandData.arguments[ returnIndex ].len );
-						size_t pos = size.find( "->" );
-						assert( pos != std::string::npos );
-						size.replace( pos, 2, "." );
-					}
-					else
-					{
-						for( auto& sit : vectorParameters )
-						{
-							if( sit.first != returnIndex && sit.second == it->second )
-							{
-								size = _reduceName( commandData.arguments[ sit.first ].name ) + ".size()";
-								break;
-							}
-						}
-					}
-					assert( !size.empty() );
-					ofs << "( " << size << " )";
-				}
-				ofs << ";\n";
-			}
-			else if( 1 < commandData.successCodes.size() )
-			{
-				ofs << _indent << "  "
-					<< commandData.arguments[ returnIndex ].pureType
-					<< " " << _reduceName( commandData.arguments[ returnIndex ].name )
-					<< ";\n";
-			}
-		}
-
-		// local count variable to hold the size of the vector to fill
-		if( commandData.twoStep )
-		{
-			assert( returnIndex != ~0 );
-
-			auto returnit = vectorParameters.find( returnIndex );
-			assert( returnit != vectorParameters.end() && returnit->second != ~0 );
-			assert( commandData.returnType == "Result" || commandData.returnType == "void" );
-
-			ofs << _indent << "  "
-				<< commandData.arguments[ returnit->second ].pureType << " "
-				<< _reduceName( commandData.arguments[ returnit->second ].name )
-					<< ";\n";
-		}
-
-		// write the function call
-		ofs << _indent << "  ";
-		std::string localIndentation = "  ";
-		if( commandData.returnType == "Result" )
-		{
-			ofs << "Result result";
-			if( commandData.twoStep && ( 1 < commandData.successCodes.size() ) )
-			{
-				ofs << ";\n"
-					<< _indent << "  do\n"
-					<< _indent << "  {\n"
-					<< _indent << "    result";
-				localIndentation += "  ";
-			}
-			ofs << " = static_cast<Result>( ";
-		}
-		else if( commandData.returnType != "void" )
-		{
-			assert( !commandData.twoStep );
-			ofs << "return ";
-		}
-		_writeCall( ofs, dependencyData.name, templateIndex, commandData, vkTypes, vectorParameters, returnIndex, true );
-		if( commandData.returnType == "Result" )
-			ofs << " )";
-
-		ofs << ";\n";
-
-		if( commandData.twoStep )
-		{
-			auto returnit = vectorParameters.find( returnIndex );
-
-			if( commandData.returnType == "Result" )
-			{
-				ofs << _indent << localIndentation << "if( result == Result::eSuccess && "
-					<< _reduceName( commandData.arguments[ returnit->second ].name ) << " )\n"
-					<< _indent << localIndentation << "{\n"
-					<< _indent << localIndentation << "  ";
-			}
-			else
-				ofs << _indent << "  ";
-
-			// resize the vector to hold the data according to the result from the first call
-			ofs << _reduceName( commandData.arguments[ returnit->first ].name )
-					<< ".resize( " << _reduceName( commandData.arguments[ returnit->second ].name ) << " );\n";
-
-			// write the function call a second time
-			if( commandData.returnType == "Result" )
-				ofs << _indent << localIndentation << "  result = static_cast<Result>( ";
-
-			else
-				ofs << _indent << "  ";
-
-			_writeCall( ofs, dependencyData.name, templateIndex, commandData, vkTypes, vectorParameters, returnIndex, false );
-			if( commandData.returnType == "Result" )
-				ofs << " )";
-
-			ofs << ";\n";
-			if( commandData.returnType == "Result" )
-			{
-				ofs << _indent << localIndentation << "}\n";
-				if( 1 < commandData.successCodes.size() )
-					ofs << _indent << "  } while( result == Result::eIncomplete );\n";
-			}
-		}
-
-		if( commandData.returnType == "Result" || !commandData.successCodes.empty() )
-		{
-			ofs << _indent << "  return createResultValue( result, ";
-			if( returnIndex != ~0 )
-				ofs << _reduceName( commandData.arguments[ returnIndex ].name ) << ", ";
-
-			ofs << "\"vk::" << ( className.empty() ? "" : className + "::" ) << functionName << "\"";
-			if( 1 < commandData.successCodes.size() && !commandData.twoStep )
-			{
-				ofs << ", { Result::" << commandData.successCodes[ 0 ];
-				for( size_t i = 1; i < commandData.successCodes.size(); i++ )
-					ofs << ", Result::" << commandData.successCodes[ i ];
-
-				ofs << " }";
-			}
-			ofs << " );\n";
-		}
-		else if( returnIndex != ~0 && commandData.returnType != returnType )
-			ofs << _indent << "  return " << _reduceName( commandData.arguments[ returnIndex ].name ) << ";\n";
-
-		ofs << _indent << "}\n";
-	}
-	//--------------------------------------------------------------------------
-	void CppGenerator::_writeCall( std::ofstream& ofs, std::string const& name,
-								   size_t templateIndex,
-								   CommandData const& commandData,
-								   std::set<std::string> const& vkTypes,
-								   std::map<size_t, size_t> const& vectorParameters,
-								   size_t returnIndex, bool firstCall ) const
-	{
-		std::map<size_t, size_t> countIndices;
-		for( auto& it : vectorParameters )
-			countIndices.insert( std::make_pair( it.second, it.first ) );
-
-		if( vectorParameters.size() == 1
-			&& ( commandData.arguments[ vectorParameters.begin()->first ].len == "dataSize/4"
-				 || commandData.arguments[ vectorParameters.begin()->first ].len == "latexmath:[$dataSize \\over 4$]" ) )
-		{
-			assert( commandData.arguments[ 3 ].name == "dataSize" );
-			countIndices.insert( std::make_pair( 3, vectorParameters.begin()->first ) );
-		}
-
-		assert( islower( name[ 0 ] ) );
-		ofs << "vk" << static_cast<char>( toupper( name[ 0 ] ) ) << name.substr( 1 ) << "( ";
-		size_t i = 0;
-		if( commandData.handleCommand )
-		{
-			ofs << "m_" << commandData.arguments[ 0 ].name;
-			i++;
-		}
-		for( ; i < commandData.arguments.size(); i++ )
-		{
-			if( 0 < i )
-				ofs << ", ";
-
-			std::map<size_t, size_t>::const_iterator it = countIndices.find( i );
-			if( it != countIndices.end() )
-			{
-				if( returnIndex == it->second && commandData.twoStep )
-					ofs << "&" << _reduceName( commandData.arguments[ it->first ].name );
-
-				else
-				{
-					ofs << _reduceName( commandData.arguments[ it->second ].name ) << ".size() ";
-					if( templateIndex == it->second )
-						ofs << "* sizeof( T ) ";
-				}
-			}
-			else
-			{
-				it = vectorParameters.find( i );
-				if( it != vectorParameters.end() )
-				{
-					assert( commandData.arguments[ it->first ].type.back() == '*' );
-					if( returnIndex == it->first && commandData.twoStep && firstCall )
-						ofs << "nullptr";
-
-					else
-					{
-						auto vkit = vkTypes.find( commandData.arguments[ it->first ].pureType );
-						if( vkit != vkTypes.end() || it->first == templateIndex )
-						{
-							ofs << "reinterpret_cast<";
-							if( commandData.arguments[ it->first ].type.find( "const" ) != std::string::npos )
-								ofs << "const ";
-
-							if( vkit != vkTypes.end() )
-								ofs << "Vk";
-
-							ofs << commandData.arguments[ it->first ].pureType
-								<< "*>( " << _reduceName( commandData.arguments[ it->first ].name ) << ".data() )";
-						}
-						else if( commandData.arguments[ it->first ].pureType == "char" )
-						{
-							ofs << _reduceName( commandData.arguments[ it->first ].name );
-							if( commandData.arguments[ it->first ].optional )
-								ofs << " ? " << _reduceName( commandData.arguments[ it->first ].name ) << "->c_str() : nullptr";
-
-							else
-								ofs << ".c_str()";
-						}
-						else
-							ofs << _reduceName( commandData.arguments[ it->first ].name ) << ".data()";
-					}
-				}
-				else if( vkTypes.find( commandData.arguments[ i ].pureType ) != vkTypes.end() )
-				{
-					if( commandData.arguments[ i ].type.back() == '*' )
-					{
-						if( commandData.arguments[ i ].type.find( "const" ) != std::string::npos )
-						{
-							ofs << "reinterpret_cast<const Vk" << commandData.arguments[ i ].pureType << "*>( ";
-							if( commandData.arguments[ i ].optional )
-								ofs << "static_cast<const " << commandData.arguments[ i ].pureType << "*>( ";
-							else
-								ofs << "&";
-
-							ofs << _reduceName( commandData.arguments[ i ].name ) << ( commandData.arguments[ i ].optional ? ") )" : " )" );
-						}
-						else
-						{
-							assert( !commandData.arguments[ i ].optional );
-							ofs << "reinterpret_cast<Vk" << commandData.arguments[ i ].pureType << "*>( &" << _reduceName( commandData.arguments[ i ].name ) << " )";
-						}
-					}
-					else
-						ofs << "static_cast<Vk" << commandData.arguments[ i ].pureType << ">( " << commandData.arguments[ i ].name << " )";
-				}
-				else
-				{
-					if( commandData.arguments[ i ].type.back() == '*' )
-					{
-						if( commandData.arguments[ i ].type.find( "const" ) != std::string::npos )
-						{
-							assert( commandData.arguments[ i ].type.find( "char" ) != std::string::npos );
-							ofs << _reduceName( commandData.arguments[ i ].name );
-							if( commandData.arguments[ i ].optional )
-								ofs << " ? " << _reduceName( commandData.arguments[ i ].name ) << "->c_str() : nullptr";
-							else
-								ofs << ".c_str()";
-						}
-						else
-						{
-							assert( commandData.arguments[ i ].type.find( "char" ) == std::string::npos );
-							ofs << "&" << _reduceName( commandData.arguments[ i ].name );
-						}
-					}
-					else
-						ofs << commandData.arguments[ i ].name;
-				}
-			}
-		}
-		ofs << " )";
-	}
-	//--------------------------------------------------------------------------
-	void CppGenerator::_writeComment( std::ofstream& ofs, std::string const& name,
-						std::string const& type ) const
-	{
-		ofs << _indent << "/**\n"
-			<< _indent << " * @brief The " << name
-			<< " " << type << ".\n"
-			<< _indent << " */\n";
-	}
-
-
-	//Unreferenced method
-	/*void CppGenerator::_writeExceptionCheck( std::ofstream& ofs,
-											 std::string const& indentation,
-											 std::string const& className,
-											 std::string const& functionName,
-											 std::vector<std::string> const& successCodes )
-	{
-		assert( !successCodes.empty() );
-		ofs << indentation << "  if (";
-		if( successCodes.size() == 1 )
-		{
-			assert( successCodes.front() == "eSuccess" );
-			ofs << " result != Result::eSuccess";
-		}
-		else
-		{
-			for( size_t i = 0; i < successCodes.size() - 1; i++ )
-				ofs << " ( result != Result::" << successCodes[ i ] << " ) &&";
-
-			ofs << " ( result != Result::" << successCodes.back() << " )";
-		}
-		ofs << " )" << std::endl;
-		ofs << indentation << "  {" << std::endl
-			<< indentation << "    throw std::system_error( result, \"vk::";
-		if( !className.empty() )
-			ofs << className << "::";
-
-		ofs << functionName << "\" );" << std::endl
-			<< indentation << "  }" << std::endl;
-	}*/
-} // end of vk namespace
+// Copyright(c) 2015-2016, NVIDIA CORPORATION. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "VkDualOFStream.h"
+#include "VkDependencyGraph.h"
+#include "VkParallel.h"
+#include "Strings.h"
+#include "StringsHelper.h"
+
+#include <iostream>
+#include <cassert>
+#include <exception>
+#include <algorithm>
+#include <sstream>
+#include <functional>
+
+namespace vk
+{
+	int CppGenerator::generate( const Options& opt )
+	{
+		SpecParser parser( opt.threads );
+
+		// the whole model, and the arena it lives in, goes away with specData
+		std::unique_ptr<SpecData> specData = opt.mappedInput ? parser.parseMapped( opt.inputFile )
+															 : parser.parse( opt.inputFile );
+		if( !specData )
+			return -1;
+
+		SpecData* vkData = specData.get();
+
+		try
+		{
+			_sortDependencies( vkData->dependencies, vkData->symbols );
+
+			std::map<std::string, std::string> defaultValues;
+			_createDefaults( vkData, defaultValues );
+
+			DualOFStream ofs( opt );
+			_threads = opt.threads;
+			_stringTables = opt.stringTables;
+			_constexprTypes = opt.constexprTypes;
+			_statefulCommandBuffer = opt.statefulCommandBuffer;
+			_indent.setIndentChar( opt.indentChar );
+			_indent.setSize( opt.spaceSize );
+
+			ofs << nvidiaLicenseHeader
+				<< vkData->vulkanLicenseHeader << std::endl
+				<< ( !opt.cmdLine.empty() ? "// Command line options: " + opt.cmdLine + "\n" : "" );
+
+			if( ofs.usingDualStream() )
+			{
+				if( !opt.pch.empty() )
+					ofs.src() << "#include \"" << opt.pch << "\"\n";
+
+				ofs.src() << "#include \"" << ofs.headerFileName() << "\"\n";
+			}
+
+			ofs.hdr() << "#ifndef " << opt.includeGuard << std::endl
+				<< "#define " << opt.includeGuard << std::endl << std::endl;
+
+			ofs.src() << "#include <cstdint>\n"
+					  << "#include <string>\n"
+					  << "#include <system_error>\n";
+
+			ofs.hdr() << "#include <array>\n"
+					  << "#include <algorithm>\n"
+					  << "#include <atomic>\n"
+					  << "#include <cassert>\n"
+					  << "#include <cstring>\n"
+					  << "#include <iterator>\n"
+					  << "#include <new>\n"
+					  << "#include <type_traits>\n"
+					  << "#include <utility>\n"
+					  << ( _stringTables ? "#if defined( _MSC_VER )\n# include <intrin.h>\n#endif\n" : "" )
+					  << "#include <vulkan/vulkan.h>\n"
+					  << "#ifndef VKCPP_DISABLE_ENHANCED_MODE\n"
+					  << "#" << _indent + 1 << "include <vector>\n"
+					  << "#endif /*VKCPP_DISABLE_ENHANCED_MODE*/\n\n";
+
+			_writeVersionCheck( ofs.src(), vkData->version );
+			_writeTypesafeCheck( ofs.hdr(), vkData->typesafeCheck );
+
+			ofs.hdr() << versionCheckHeader
+					  << constexprHeader;
+			ofs << "namespace vk\n"
+				<< "{\n";
+
+			++_indent;
+
+			ofs.hdr() << flagsHeader
+					  << optionalClassHeader
+					  << arrayProxyHeader
+					  << smallVectorHeader
+					  << toStringHeader
+					  << fromStringHeader
+					  << ( _stringTables ? enumTableHeader : "" );
+
+			// first of all, write out vk::Result and the exception handling stuff
+			auto it = vkData->findDependency( "Result" );
+			assert( it != vkData->dependencies.end() );
+			_writeTypeEnum( ofs.hdr(), *it, vkData->enums.find( it->symbol )->second );
+			_writeEnumsToString( ofs, *it, vkData->enums.find( it->symbol )->second );
+			vkData->eraseDependency( it );
+
+			ofs.hdr() << exceptionHeader
+					  << "} // namespace vk\n\n"
+					  << isErrorCode
+					  << "\nnamespace vk\n"
+					  << "{\n"
+					  << resultValueHeader
+					  << createResultValueHeader;
+
+			_writeDispatchTables( ofs.hdr(), vkData );
+
+			_writeTypes( ofs, vkData, defaultValues );
+			ofs.hdr() << "#ifndef VKCPP_DISABLE_ENHANCED_MODE\n"
+					  << descriptorUpdateBatchHeader
+					  << "#endif /*VKCPP_DISABLE_ENHANCED_MODE*/\n\n";
+			_writeUniqueHandles( ofs.hdr(), vkData );
+			_writeCommandStream( ofs.hdr(), vkData );
+			if( _statefulCommandBuffer )
+				_writeStatefulCommandBuffer( ofs.hdr(), vkData );
+			_writeEnumsToString( ofs, vkData );
+
+			ofs << "} // namespace vk\n";
+			ofs.hdr() << "#endif // " << opt.includeGuard << std::endl;
+			ofs.close();
+		}
+		catch( const std::exception& e )
+		{
+			std::cerr << "caught exception: " << e.what() << std::endl;
+			return -1;
+		}
+		catch( ... )
+		{
+			std::cerr << "caught unknown exception" << std::endl;
+			return -1;
+		}
+
+		return 0;
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_enterProtect( DualOFStream& ofs,
+									  std::string const& protect ) const
+	{
+		if( !protect.empty() )
+			ofs << "#ifdef " << protect << std::endl;
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_leaveProtect( DualOFStream& ofs,
+									  std::string const& protect ) const
+	{
+		if( !protect.empty() )
+			ofs << "#endif /*" << protect << "*/" << std::endl;
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_enterProtect( std::ostream& ofs,
+									  std::string const& protect ) const
+	{
+		if( !protect.empty() )
+			ofs << "#ifdef " << protect << std::endl;
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_leaveProtect( std::ostream& ofs,
+									  std::string const& protect ) const
+	{
+		if( !protect.empty() )
+			ofs << "#endif /*" << protect << "*/" << std::endl;
+	}
+	//--------------------------------------------------------------------------
+	std::string CppGenerator::_determineFunctionName( std::string const& name,
+													  CommandData const& commandData ) const
+	{
+		if( commandData.handleCommand )
+		{
+			std::string strippedName = name;
+			std::string searchName = commandData.arguments[ 0 ].pureType;
+			size_t pos = name.find( searchName );
+			if( pos == std::string::npos )
+			{
+				assert( isupper( searchName[ 0 ] ) );
+				searchName[ 0 ] = tolower( searchName[ 0 ] );
+				pos = name.find( searchName );
+			}
+			if( pos != std::string::npos )
+				strippedName.erase( pos, commandData.arguments[ 0 ].pureType.length() );
+
+			else if( commandData.arguments[ 0 ].pureType == "CommandBuffer"
+					 && name.find( "cmd" ) == 0 )
+			{
+				strippedName.erase( 0, 3 );
+				pos = 0;
+			}
+			if( pos == 0 )
+			{
+				assert( isupper( strippedName[ 0 ] ) );
+				strippedName[ 0 ] = tolower( strippedName[ 0 ] );
+			}
+			return strippedName;
+		}
+		return name;
+	}
+	//--------------------------------------------------------------------------
+	std::string CppGenerator::_determineReturnType( CommandData const& commandData,
+													size_t returnIndex,
+													bool isVector ) const
+	{
+		std::string returnType;
+		if( returnIndex != ~0
+			&& ( commandData.returnType == "void"
+				 || ( commandData.returnType == "Result"
+					  && ( commandData.successCodes.size() == 1
+						   || ( commandData.successCodes.size() == 2
+								&& commandData.successCodes[ 1 ] == "eIncomplete"
+								&& commandData.twoStep ) ) ) ) )
+		{
+			if( isVector )
+			{
+				if( commandData.arguments[ returnIndex ].pureType == "void" )
+					returnType = "std::vector<uint8_t, Allocator>";
+
+				else
+					returnType = "std::vector<" + commandData.arguments[ returnIndex ].pureType + ", Allocator>";
+			}
+			else
+			{
+				assert( commandData.arguments[ returnIndex ].type.back() == '*' );
+				assert( commandData.arguments[ returnIndex ].type.find( "const" ) == std::string::npos );
+				returnType = commandData.arguments[ returnIndex ].type;
+				returnType.pop_back();
+			}
+		}
+		else if( commandData.returnType == "Result" && commandData.successCodes.size() == 1 )
+		{
+			// an original return of type "Result" with less just one successCode is changed to void, errors throw an exception
+			returnType = "void";
+		}
+		else
+		{
+			// the return type just stays the original return type
+			returnType = commandData.returnType;
+		}
+		return returnType;
+	}
+	//--------------------------------------------------------------------------
+	size_t CppGenerator::_determineInlineCapacity( std::string const& name ) const
+	{
+		// enumerations which usually return a handful of small values; the
+		// others (layers, extensions, pipeline cache data) stay a std::vector
+		static std::map<std::string, size_t> const capacities = {
+			{ "enumeratePhysicalDevices", 4 },
+			{ "getDisplayModePropertiesKHR", 8 },
+			{ "getDisplayPlaneSupportedDisplaysKHR", 4 },
+			{ "getImageSparseMemoryRequirements", 4 },
+			{ "getPhysicalDeviceDisplayPlanePropertiesKHR", 4 },
+			{ "getPhysicalDeviceDisplayPropertiesKHR", 4 },
+			{ "getPhysicalDeviceQueueFamilyProperties", 8 },
+			{ "getPhysicalDeviceSparseImageFormatProperties", 4 },
+			{ "getPhysicalDeviceSurfaceFormatsKHR", 8 },
+			{ "getPhysicalDeviceSurfacePresentModesKHR", 8 },
+			{ "getSwapchainImagesKHR", 4 }
+		};
+
+		auto it = capacities.find( name );
+		return it != capacities.end() ? it->second : 0;
+	}
+	//--------------------------------------------------------------------------
+	bool CppGenerator::_getEnumValues( EnumData const& enumData,
+									   std::vector<std::pair<int64_t, size_t>>& values ) const
+	{
+		values.clear();
+		for( size_t i = 0; i < enumData.members.size(); i++ )
+		{
+			// the value is followed by the comment naming the vk enum
+			std::string const& value = enumData.members[ i ].value;
+			std::string number = StringsHelper::trimEnd( value.substr( 0, value.find( ',' ) ) );
+
+			char* end;
+			int64_t v = strtoll( number.c_str(), &end, 0 );
+			if( number.empty() || *end )
+				return false;
+
+			values.push_back( std::make_pair( v, i ) );
+		}
+		std::stable_sort( values.begin(), values.end(),
+						  []( std::pair<int64_t, size_t> const& a, std::pair<int64_t, size_t> const& b ) { return a.first < b.first; } );
+		return true;
+	}
+	//--------------------------------------------------------------------------
+	std::string CppGenerator::_reduceName( std::string const& name ) const
+	{
+		std::string reducedName;
+		if( name[ 0 ] == 'p' && 1 < name.length() && ( isupper( name[ 1 ] ) || name[ 1 ] == 'p' ) )
+		{
+			reducedName = StringsHelper::strip( name, "p" );
+			reducedName[ 0 ] = tolower( reducedName[ 0 ] );
+		}
+		else
+			reducedName = name;
+
+		return reducedName;
+	}
+	//--------------------------------------------------------------------------
+	size_t CppGenerator::_findReturnIndex( CommandData const& commandData,
+										   std::map<size_t, size_t> const& vectorParameters ) const
+	{
+		if( commandData.returnType == "Result" || commandData.returnType == "void" )
+		{
+			for( size_t i = 0; i < commandData.arguments.size(); i++ )
+			{
+				if( commandData.arguments[ i ].type.find( '*' ) != std::string::npos
+					&& commandData.arguments[ i ].type.find( "const" ) == std::string::npos
+					&& !_isVectorSizeParameter( vectorParameters, i )
+					&& ( vectorParameters.find( i ) == vectorParameters.end()
+						 || commandData.twoStep
+						 || commandData.successCodes.size() == 1 ) )
+				{
+	#if !defined(NDEBUG)
+					for( size_t j = i + 1; j < commandData.arguments.size(); j++ )
+					{
+						assert( commandData.arguments[ j ].type.find( '*' ) == std::string::npos
+								|| commandData.arguments[ j ].type.find( "const" ) != std::string::npos );
+					}
+	#endif
+					return i;
+				}
+			}
+		}
+		return ~0;
+	}
+	//--------------------------------------------------------------------------
+	size_t CppGenerator::_findTemplateIndex( CommandData const& commandData,
+											 std::map<size_t, size_t> const& vectorParameters ) const
+	{
+		for( size_t i = 0; i < commandData.arguments.size(); i++ )
+		{
+			if( commandData.arguments[ i ].name == "pData"
+				|| commandData.arguments[ i ].name == "pValues" )
+			{
+				assert( vectorParameters.find( i ) != vectorParameters.end() );
+				return i;
+			}
+		}
+		return ~0;
+	}
+	//--------------------------------------------------------------------------
+	std::map<size_t, size_t> CppGenerator::_getVectorParameters( CommandData const& commandData ) const
+	{
+		std::map<size_t, size_t> lenParameters;
+		for( size_t i = 0; i < commandData.arguments.size(); i++ )
+		{
+			if( !commandData.arguments[ i ].len.empty() )
+			{
+				lenParameters.insert( std::make_pair( i, ~0 ) );
+				for( size_t j = 0; j < commandData.arguments.size(); j++ )
+				{
+					if( commandData.arguments[ i ].len == commandData.arguments[ j ].name )
+						lenParameters[ i ] = j;
+				}
+				assert( lenParameters[ i ] != ~0
+					|| commandData.arguments[ i ].len == "dataSize/4"
+					|| commandData.arguments[ i ].len == "latexmath:[$dataSize \\over 4$]"
+					|| commandData.arguments[ i ].len == "null-terminated"
+					|| commandData.arguments[ i ].len == "pAllocateInfo->descriptorSetCount"
+					|| commandData.arguments[ i ].len == "pAllocateInfo->commandBufferCount" );
+				assert( lenParameters[ i ] == ~0 || lenParameters[ i ] < i );
+			}
+		}
+		return lenParameters;
+	}
+	//--------------------------------------------------------------------------
+	bool CppGenerator::_hasPointerArguments( CommandData const& commandData ) const
+	{
+		for( size_t i = 0; i < commandData.arguments.size(); i++ )
+		{
+			size_t pos = commandData.arguments[ i ].type.find( '*' );
+			if( pos != std::string::npos &&
+				commandData.arguments[ i ].type.find( '*', pos + 1 ) == std::string::npos )
+				return true;
+		}
+		return false;
+	}
+	//--------------------------------------------------------------------------
+	bool CppGenerator::_isVectorSizeParameter( std::map<size_t, size_t> const& vectorParameters,
+											   size_t idx ) const
+	{
+		for( auto& it : vectorParameters )
+		{
+			if( it.second == idx )
+				return true;
+		}
+		return false;
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_sortDependencies( DependencyList& dependencies,
+										  SymbolTable& symbols ) const
+	{
+		std::vector<size_t> order = DependencyGraph( dependencies, symbols, { "VkFlags" } ).sort();
+
+		std::vector<DependencyList::iterator> nodes;
+		nodes.reserve( dependencies.size() );
+		for( auto it = dependencies.begin(); it != dependencies.end(); ++it )
+			nodes.push_back( it );
+
+		// relink the list nodes in sorted order within the same list; neither
+		// DependencyData nor iterators held by SpecData::findDependency move
+		for( auto idx : order )
+			dependencies.splice( dependencies.end(), dependencies, nodes[ idx ] );
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_createDefaults( SpecData* vkData,
+										std::map<std::string, std::string>& defaultValues ) const
+	{
+		for( auto& it : vkData->dependencies )
+		{
+			assert( defaultValues.find( it.name ) == defaultValues.end() );
+			switch( it.category )
+			{
+				case DependencyData::Category::COMMAND:    // commands should never be asked for defaults
+					break;
+
+				case DependencyData::Category::ENUM:
+				{
+					assert( vkData->enums.find( it.name ) != vkData->enums.end() );
+					auto& enumData = vkData->enums.find( it.name )->second;
+					auto value = it.name;
+
+					if( !enumData.members.empty() )
+						value += "::" + vkData->enums.find( it.name )->second.members.front().name;
+					else
+						value += "()";
+
+					defaultValues[ it.name ] = value;
+				}
+				break;
+
+				case DependencyData::Category::FLAGS:
+				case DependencyData::Category::HANDLE:
+				case DependencyData::Category::STRUCT:
+				case DependencyData::Category::UNION:        // just call the default constructor for flags, structs, and structs (which are mapped to classes)
+					defaultValues[ it.name ] = it.name + "()";
+					break;
+
+				case DependencyData::Category::FUNC_POINTER: // func_pointers default to nullptr
+					defaultValues[ it.name ] = "nullptr";
+					break;
+
+				case DependencyData::Category::REQUIRED:     // all required default to "0"
+				case DependencyData::Category::SCALAR:       // all scalars default to "0"
+					defaultValues[ it.name ] = "0";
+					break;
+
+				default:
+					assert( false );
+					break;
+			}
+		}
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeVersionCheck( std::ostream& ofs,
+										  std::string const& version ) const
+	{
+		ofs << "static_assert( VK_HEADER_VERSION == " << version
+			<< ", \"Wrong VK_HEADER_VERSION!\" );\n\n";
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeTypesafeCheck( std::ostream& ofs,
+											std::string const& typesafeCheck ) const
+	{
+		ofs << "// 32-bit vulkan is not typesafe for handles, so don't allow copy constructors on this platform by default.\n"
+			<< "// To enable this feature on 32-bit platforms please define VK_CPP_TYPESAFE_CONVERSION\n"
+			<< typesafeCheck << std::endl
+			<< "#define VK_CPP_TYPESAFE_CONVERSION 1\n"
+			<< "#endif\n\n";
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeDispatchTables( std::ostream& ofs, SpecData* vkData )
+	{
+		// the dispatchable handle a command is called on tells its level
+		std::vector<SymbolMap<CommandData>::const_iterator> instanceCommands, deviceCommands;
+		for( auto it = vkData->commands.begin(); it != vkData->commands.end(); ++it )
+		{
+			if( !it->second.handleCommand )
+				continue;
+
+			StringRef handle = it->second.arguments[ 0 ].pureType;
+			if( handle == "Instance" || handle == "PhysicalDevice" )
+				instanceCommands.push_back( it );
+			else
+			{
+				assert( handle == "Device" || handle == "Queue" || handle == "CommandBuffer" );
+				deviceCommands.push_back( it );
+			}
+		}
+
+		// forwards to the functions exported by the loader, the default dispatcher
+		ofs << _indent << "class GlobalDispatch\n"
+			<< _indent << "{\n"
+			<< _indent << "public:\n";
+
+		++_indent;
+		for( auto& it : vkData->commands )
+		{
+			if( !it.second.handleCommand )
+				continue;
+
+			CommandData const& commandData = it.second;
+			std::string callName = "vk" + std::string( 1, static_cast<char>( toupper( it.first[ 0 ] ) ) ) + it.first.substr( 1 );
+
+			_enterProtect( ofs, commandData.protect );
+			ofs << _indent << _getCType( commandData.returnType, vkData ) << " " << callName << "( ";
+			for( size_t i = 0; i < commandData.arguments.size(); i++ )
+			{
+				MemberData const& argument = commandData.arguments[ i ];
+				ofs << ( i ? ", " : "" ) << _getCType( argument.type, vkData, argument.pureType ) << " " << argument.name;
+				if( !argument.arraySize.empty() )
+					ofs << "[ " << argument.arraySize << " ]";
+			}
+			ofs << " ) const\n"
+				<< _indent << "{\n"
+				<< _indent << "  " << ( commandData.returnType != "void" ? "return ::" : "::" ) << callName << "( ";
+			for( size_t i = 0; i < commandData.arguments.size(); i++ )
+				ofs << ( i ? ", " : "" ) << commandData.arguments[ i ].name;
+
+			ofs << " );\n"
+				<< _indent << "}\n";
+			_leaveProtect( ofs, commandData.protect );
+		}
+		--_indent;
+		ofs << _indent << "};\n\n";
+
+		_writeDispatchTable( ofs, "InstanceDispatch", "Instance", instanceCommands );
+		_writeDispatchTable( ofs, "DeviceDispatch", "Device", deviceCommands );
+
+		// both levels in one table, for the handle methods of every kind to share a default
+		ofs << _indent << "struct DispatchTable : InstanceDispatch, DeviceDispatch\n"
+			<< _indent << "{\n"
+			<< _indent << "  using InstanceDispatch::init;\n"
+			<< _indent << "  using DeviceDispatch::init;\n"
+			<< _indent << "};\n\n";
+
+		// the instance handle methods use when none is given; GlobalDispatch is
+		// empty, so the default costs nothing and the handles keep their size
+		ofs << _indent << "template <typename Dispatch>\n"
+			<< _indent << "struct DefaultDispatch\n"
+			<< _indent << "{\n"
+			<< _indent << "  static Dispatch dispatch;\n"
+			<< _indent << "};\n\n"
+			<< _indent << "template <typename Dispatch>\n"
+			<< _indent << "Dispatch DefaultDispatch<Dispatch>::dispatch;\n\n"
+			<< "#ifndef VK_CPP_DEFAULT_DISPATCH\n"
+			<< "# define VK_CPP_DEFAULT_DISPATCH GlobalDispatch\n"
+			<< "#endif\n\n";
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeCommandStream( std::ostream& ofs, SpecData* vkData )
+	{
+		// the commands recorded into a command buffer
+		std::vector<SymbolMap<CommandData>::const_iterator> commands;
+		for( auto it = vkData->commands.begin(); it != vkData->commands.end(); ++it )
+		{
+			if( it->second.handleCommand && it->second.arguments[ 0 ].pureType == "CommandBuffer"
+				&& it->second.returnType == "void" )
+			{
+				assert( it->first.compare( 0, 3, "cmd" ) == 0 );
+				commands.push_back( it );
+			}
+		}
+
+		ofs << "#ifndef VKCPP_DISABLE_ENHANCED_MODE\n"
+			<< commandStreamHeader;
+
+		// numbered, so that records don't depend on the platforms enabled
+		ofs << _indent << "enum class CommandOpcode : uint32_t\n"
+			<< _indent << "{\n";
+		for( size_t i = 0; i < commands.size(); i++ )
+		{
+			_enterProtect( ofs, commands[ i ]->second.protect );
+			ofs << _indent << "  e" << commands[ i ]->first.substr( 3 ) << " = " << i << ",\n";
+			_leaveProtect( ofs, commands[ i ]->second.protect );
+		}
+		ofs << _indent << "};\n\n";
+
+		// a dispatcher which records the commands instead of calling them
+		ofs << _indent << "// records the commands it is the dispatcher of into a stream, the command buffer they\n"
+			<< _indent << "// are called on is ignored:\n"
+			<< _indent << "//   vk::CommandRecorder<> recorder( stream );\n"
+			<< _indent << "//   vk::CommandBuffer().draw( 3, 1, 0, 0, recorder );\n"
+			<< _indent << "template <typename Allocator = std::allocator<uint64_t>>\n"
+			<< _indent << "class CommandRecorder\n"
+			<< _indent << "{\n"
+			<< _indent << "public:\n"
+			<< _indent << "  explicit CommandRecorder( CommandStream<Allocator>& stream )\n"
+			<< _indent << "    : m_stream( &stream )\n"
+			<< _indent << "  {}\n";
+
+		++_indent;
+		for( auto& it : commands )
+		{
+			CommandData const& commandData = it->second;
+			std::string callName = "vk" + std::string( 1, static_cast<char>( toupper( it->first[ 0 ] ) ) ) + it->first.substr( 1 );
+
+			_enterProtect( ofs, commandData.protect );
+			ofs << "\n" << _indent << "void " << callName << "( VkCommandBuffer";
+			for( size_t i = 1; i < commandData.arguments.size(); i++ )
+			{
+				MemberData const& argument = commandData.arguments[ i ];
+				ofs << ", " << _getCType( argument.type, vkData, argument.pureType ) << " " << argument.name;
+				if( !argument.arraySize.empty() )
+					ofs << "[ " << argument.arraySize << " ]";
+			}
+			ofs << " ) const\n"
+				<< _indent << "{\n";
+
+			++_indent;
+			ofs << _indent << "size_t record = m_stream->beginRecord( static_cast<uint32_t>( CommandOpcode::e" << it->first.substr( 3 ) << " ) );\n";
+			for( size_t i = 1; i < commandData.arguments.size(); i++ )
+				_writeRecordArgument( ofs, vkData, commandData.arguments[ i ] );
+
+			ofs << _indent << "m_stream->endRecord( record );\n";
+			ofs << --_indent << "}\n";
+			_leaveProtect( ofs, commandData.protect );
+		}
+		--_indent;
+
+		ofs << "\n"
+			<< _indent << "private:\n"
+			<< _indent << "  CommandStream<Allocator>* m_stream;\n"
+			<< _indent << "};\n\n";
+
+		// the records are replayed through the same dispatchers as the handle methods
+		ofs << _indent << "template <typename Dispatch = VK_CPP_DEFAULT_DISPATCH>\n"
+			<< _indent << "void replay( uint64_t const* firstRecord, uint64_t const* lastRecord, CommandBuffer commandBuffer, Dispatch const& d = DefaultDispatch<Dispatch>::dispatch )\n"
+			<< _indent << "{\n";
+
+		++_indent;
+		ofs << _indent << "VkCommandBuffer vkCommandBuffer = static_cast<VkCommandBuffer>( commandBuffer );\n"
+			<< _indent << "for( uint64_t const* record = firstRecord; record != lastRecord; record += *record >> 32 )\n"
+			<< _indent << "{\n";
+
+		++_indent;
+		ofs << _indent << "CommandArguments arguments( record + 1 );\n"
+			<< _indent << "switch( static_cast<CommandOpcode>( static_cast<uint32_t>( *record ) ) )\n"
+			<< _indent << "{\n";
+		for( auto& it : commands )
+		{
+			CommandData const& commandData = it->second;
+			std::string callName = "vk" + std::string( 1, static_cast<char>( toupper( it->first[ 0 ] ) ) ) + it->first.substr( 1 );
+
+			_enterProtect( ofs, commandData.protect );
+			ofs << _indent << "case CommandOpcode::e" << it->first.substr( 3 ) << ":\n"
+				<< _indent << "{\n";
+
+			++_indent;
+			for( size_t i = 1; i < commandData.arguments.size(); i++ )
+				_writeReplayArgument( ofs, vkData, commandData.arguments[ i ] );
+
+			ofs << _indent << "d." << callName << "( vkCommandBuffer";
+			for( size_t i = 1; i < commandData.arguments.size(); i++ )
+			{
+				MemberData const& argument = commandData.arguments[ i ];
+				std::string cType = _getCType( argument.type, vkData, argument.pureType );
+				if( argument.type.back() == '*' && argument.type.find( "const" ) != 0 )
+					ofs << ", const_cast<" << cType << ">( " << argument.name << " )";
+				else
+					ofs << ", " << argument.name;
+			}
+			ofs << " );\n";
+
+			ofs << --_indent << "}\n"
+				<< _indent << "break;\n";
+			_leaveProtect( ofs, commandData.protect );
+		}
+		ofs << _indent << "}\n";
+		ofs << --_indent << "}\n";
+		ofs << --_indent << "}\n\n";
+
+		ofs << _indent << "template <typename Allocator, typename Dispatch = VK_CPP_DEFAULT_DISPATCH>\n"
+			<< _indent << "void replay( CommandStream<Allocator> const& stream, CommandBuffer commandBuffer, Dispatch const& d = DefaultDispatch<Dispatch>::dispatch )\n"
+			<< _indent << "{\n"
+			<< _indent << "  replay( stream.words().data(), stream.words().data() + stream.words().size(), commandBuffer, d );\n"
+			<< _indent << "}\n"
+			<< "#endif /*VKCPP_DISABLE_ENHANCED_MODE*/\n\n";
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeUniqueHandles( std::ostream& ofs, SpecData* vkData )
+	{
+		// the destroy and free commands, by the deleter holding the arguments they take besides the handle
+		std::map<std::string, std::vector<SymbolMap<CommandData>::const_iterator>> deleters;
+		for( auto it = vkData->commands.begin(); it != vkData->commands.end(); ++it )
+		{
+			if( it->first.compare( 0, 7, "destroy" ) == 0 || it->first.compare( 0, 4, "free" ) == 0 )
+				deleters[ _getDeleterName( it->second ) ].push_back( it );
+		}
+
+		ofs << "#ifndef VKCPP_DISABLE_ENHANCED_MODE\n"
+			<< uniqueHandleHeader;
+
+		for( auto& deleter : deleters )
+		{
+			// the arguments all the commands of a deleter share
+			CommandData const& first = deleter.second.front()->second;
+			std::vector<MemberData const*> state;
+			for( size_t i = 0; i < first.arguments.size(); i++ )
+			{
+				if( _isDeleterState( first, i ) )
+					state.push_back( &first.arguments[ i ] );
+			}
+
+			ofs << _indent << "template <typename Dispatch = VK_CPP_DEFAULT_DISPATCH>\n"
+				<< _indent << "class " << deleter.first << "\n"
+				<< _indent << "{\n"
+				<< _indent << "public:\n";
+
+			++_indent;
+			ofs << _indent << "explicit " << deleter.first << "( ";
+			for( auto argument : state )
+			{
+				if( argument->pureType == "AllocationCallbacks" )
+					ofs << "AllocationCallbacks const* allocator = nullptr, ";
+				else
+					ofs << argument->pureType << " " << argument->name << ", ";
+			}
+			ofs << "Dispatch const& d = DefaultDispatch<Dispatch>::dispatch )\n";
+			for( size_t i = 0; i < state.size(); i++ )
+				ofs << _indent << ( i ? "  , " : "  : " ) << _getDeleterMember( *state[ i ] ) << "( " << _getDeleterMember( *state[ i ] ).substr( 2 ) << " )\n";
+			ofs << _indent << ( state.empty() ? "  : " : "  , " ) << "m_dispatch( &d )\n"
+				<< _indent << "{}\n";
+
+			for( auto& it : deleter.second )
+			{
+				CommandData const& commandData = it->second;
+				std::string callName = "vk" + std::string( 1, static_cast<char>( toupper( it->first[ 0 ] ) ) ) + it->first.substr( 1 );
+				size_t index = _getDestroyedIndex( commandData );
+				std::string handle = commandData.arguments[ index ].pureType.str();
+				std::string name = std::string( 1, static_cast<char>( tolower( handle[ 0 ] ) ) ) + handle.substr( 1 );
+
+				_enterProtect( ofs, commandData.protect );
+				ofs << "\n"
+					<< _indent << "void operator()( " << handle << " " << name << " ) const\n"
+					<< _indent << "{\n"
+					<< _indent << "  m_dispatch->" << callName << "( ";
+				for( size_t i = 0; i < commandData.arguments.size(); i++ )
+				{
+					MemberData const& argument = commandData.arguments[ i ];
+					std::string cType = _getCType( argument.pureType, vkData );
+					ofs << ( i ? ", " : "" );
+					if( i == index && argument.type.back() == '*' )
+						ofs << "reinterpret_cast<const " << cType << "*>( &" << name << " )";
+					else if( i == index )
+						ofs << "static_cast<" << cType << ">( " << name << " )";
+					else if( argument.pureType == "AllocationCallbacks" )
+						ofs << "reinterpret_cast<const VkAllocationCallbacks*>( m_allocator )";
+					else if( _isDeleterState( commandData, i ) )
+						ofs << "static_cast<" << cType << ">( " << _getDeleterMember( argument ) << " )";
+					else
+					{
+						// the count of the handles freed
+						assert( commandData.arguments[ index ].len == argument.name );
+						ofs << "1";
+					}
+				}
+				ofs << " );\n"
+					<< _indent << "}\n";
+				_leaveProtect( ofs, commandData.protect );
+			}
+			--_indent;
+
+			ofs << "\n"
+				<< _indent << "private:\n";
+
+			++_indent;
+			for( auto argument : state )
+			{
+				ofs << _indent << ( argument->pureType == "AllocationCallbacks" ? "AllocationCallbacks const*" : argument->pureType.str() )
+					<< " " << _getDeleterMember( *argument ) << ";\n";
+			}
+			ofs << _indent << "Dispatch const* m_dispatch;\n";
+			ofs << --_indent << "};\n\n";
+		}
+
+		for( auto& deleter : deleters )
+		{
+			for( auto& it : deleter.second )
+			{
+				std::string handle = it->second.arguments[ _getDestroyedIndex( it->second ) ].pureType.str();
+				_enterProtect( ofs, it->second.protect );
+				ofs << _indent << "typedef UniqueHandle<" << handle << ", " << deleter.first << "<>> Unique" << handle << ";\n";
+				_leaveProtect( ofs, it->second.protect );
+			}
+		}
+
+		// the instance and the device aren't destroyed while a frame of theirs is in flight
+		ofs << "\n"
+			<< deferredDeleterHeader;
+		for( auto& deleter : deleters )
+		{
+			if( deleter.first != "AllocatorDeleter" )
+				ofs << _indent << "typedef DeferredDeleter<" << deleter.first << "<>> Deferred" << deleter.first << ";\n";
+		}
+		ofs << "#endif /*VKCPP_DISABLE_ENHANCED_MODE*/\n\n";
+	}
+	//--------------------------------------------------------------------------
+	size_t CppGenerator::_getDestroyedIndex( CommandData const& commandData ) const
+	{
+		// destroyInstance( instance, pAllocator ), destroyBuffer( device, buffer, pAllocator ),
+		// or freeCommandBuffers( device, commandPool, commandBufferCount, pCommandBuffers )
+		if( commandData.arguments.size() == 2 )
+			return 0;
+		if( commandData.arguments.size() == 3 )
+			return 1;
+		assert( commandData.arguments.size() == 4 && commandData.arguments[ 3 ].len == commandData.arguments[ 2 ].name );
+		return 3;
+	}
+	//--------------------------------------------------------------------------
+	bool CppGenerator::_isDeleterState( CommandData const& commandData, size_t index ) const
+	{
+		MemberData const& argument = commandData.arguments[ index ];
+		MemberData const& destroyed = commandData.arguments[ _getDestroyedIndex( commandData ) ];
+		if( &argument == &destroyed || argument.name == destroyed.len )
+			return false;
+		return argument.pureType == "AllocationCallbacks" || argument.type.back() != '*';
+	}
+	//--------------------------------------------------------------------------
+	std::string CppGenerator::_getDeleterName( CommandData const& commandData ) const
+	{
+		size_t index = _getDestroyedIndex( commandData );
+		assert( commandData.arguments.back().pureType == "AllocationCallbacks" || index == 3 );
+
+		// named after the parent, or the pool, the handles are destroyed through
+		if( index == 0 )
+			return "AllocatorDeleter";
+		return commandData.arguments[ index == 3 ? 1 : 0 ].pureType + "Deleter";
+	}
+	//--------------------------------------------------------------------------
+	std::string CppGenerator::_getDeleterMember( MemberData const& argument ) const
+	{
+		return argument.pureType == "AllocationCallbacks" ? "m_allocator" : "m_" + argument.name.str();
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeStatefulCommandBuffer( std::ostream& ofs, SpecData* vkData )
+	{
+		// the commands setting state which stays bound until set again; binding
+		// a pipeline overwrites the dynamic state it doesn't declare dynamic
+		static const std::vector<std::string> trackedNames = {
+			"cmdBindPipeline", "cmdBindDescriptorSets", "cmdBindVertexBuffers", "cmdBindIndexBuffer",
+			"cmdSetViewport", "cmdSetScissor", "cmdSetLineWidth", "cmdSetDepthBias", "cmdSetBlendConstants",
+			"cmdSetDepthBounds", "cmdSetStencilCompareMask", "cmdSetStencilWriteMask", "cmdSetStencilReference"
+		};
+		// the commands after which nothing is known of the state bound
+		static const std::set<std::string> resettingNames = { "beginCommandBuffer", "resetCommandBuffer", "cmdExecuteCommands" };
+
+		std::vector<SymbolMap<CommandData>::const_iterator> tracked;
+		for( auto& name : trackedNames )
+		{
+			auto it = vkData->commands.find( name );
+			if( it != vkData->commands.end() )
+			{
+				assert( it->second.protect.empty() && it->second.returnType == "void" );
+				tracked.push_back( it );
+			}
+		}
+
+		std::vector<SymbolMap<CommandData>::const_iterator> forwarded;
+		for( auto it = vkData->commands.begin(); it != vkData->commands.end(); ++it )
+		{
+			if( it->second.handleCommand && it->second.arguments[ 0 ].pureType == "CommandBuffer"
+				&& std::find( tracked.begin(), tracked.end(), it ) == tracked.end() )
+				forwarded.push_back( it );
+		}
+
+		ofs << "#ifndef VKCPP_DISABLE_ENHANCED_MODE\n"
+			<< _indent << "// a dispatcher for one command buffer, which drops the bind and set commands\n"
+			<< _indent << "// repeating the state already bound and forwards the other commands:\n"
+			<< _indent << "//   vk::StatefulCommandBuffer<> stateful( commandBuffer );\n"
+			<< _indent << "//   commandBuffer.bindPipeline( vk::PipelineBindPoint::eGraphics, pipeline, stateful );\n"
+			<< _indent << "template <typename Dispatch = VK_CPP_DEFAULT_DISPATCH>\n"
+			<< _indent << "class StatefulCommandBuffer\n"
+			<< _indent << "{\n"
+			<< _indent << "public:\n";
+
+		++_indent;
+		ofs << _indent << "explicit StatefulCommandBuffer( CommandBuffer commandBuffer, Dispatch const& d = DefaultDispatch<Dispatch>::dispatch )\n"
+			<< _indent << "  : m_commandBuffer( commandBuffer )\n"
+			<< _indent << "  , m_dispatch( &d )\n"
+			<< _indent << "  , m_elided()\n"
+			<< _indent << "{\n"
+			<< _indent << "  invalidate();\n"
+			<< _indent << "}\n\n"
+			<< _indent << "operator CommandBuffer() const\n"
+			<< _indent << "{\n"
+			<< _indent << "  return m_commandBuffer;\n"
+			<< _indent << "}\n\n"
+			<< _indent << "// forgets the state bound, for when the command buffer was changed through another dispatcher\n"
+			<< _indent << "void invalidate() const\n"
+			<< _indent << "{\n";
+		for( auto& it : tracked )
+			ofs << _indent << "  invalidate( " << _getStateMember( it->first ) << " );\n";
+		ofs << _indent << "}\n\n";
+
+		ofs << _indent << "// the calls of a command dropped so far\n"
+			<< _indent << "uint64_t elided( CommandOpcode opcode ) const\n"
+			<< _indent << "{\n"
+			<< _indent << "  switch( opcode )\n"
+			<< _indent << "  {\n";
+		for( size_t i = 0; i < tracked.size(); i++ )
+		{
+			ofs << _indent << "    case CommandOpcode::e" << tracked[ i ]->first.substr( 3 )
+				<< ": return m_elided[ " << i << " ];\n";
+		}
+		ofs << _indent << "    default: return 0;\n"
+			<< _indent << "  }\n"
+			<< _indent << "}\n\n"
+			<< _indent << "uint64_t elided() const\n"
+			<< _indent << "{\n"
+			<< _indent << "  uint64_t count = 0;\n"
+			<< _indent << "  for( uint64_t elided : m_elided )\n"
+			<< _indent << "    count += elided;\n"
+			<< _indent << "  return count;\n"
+			<< _indent << "}\n";
+
+		for( size_t i = 0; i < tracked.size(); i++ )
+			_writeStatefulCommand( ofs, vkData, tracked[ i ], i, tracked );
+
+		for( auto& it : forwarded )
+		{
+			CommandData const& commandData = it->second;
+			std::string callName = "vk" + std::string( 1, static_cast<char>( toupper( it->first[ 0 ] ) ) ) + it->first.substr( 1 );
+			bool resetting = resettingNames.find( it->first ) != resettingNames.end();
+
+			_enterProtect( ofs, commandData.protect );
+			ofs << "\n" << _indent << _getCType( commandData.returnType, vkData ) << " " << callName << "( ";
+			_writeDispatchArguments( ofs, vkData, commandData );
+			ofs << " ) const\n"
+				<< _indent << "{\n"
+				<< _indent << "  ";
+			if( commandData.returnType != "void" )
+				ofs << ( resetting ? "auto result = " : "return " );
+
+			ofs << "m_dispatch->" << callName << "( ";
+			for( size_t i = 0; i < commandData.arguments.size(); i++ )
+				ofs << ( i ? ", " : "" ) << commandData.arguments[ i ].name;
+			ofs << " );\n";
+
+			if( resetting )
+			{
+				ofs << _indent << "  invalidate();\n";
+				if( commandData.returnType != "void" )
+					ofs << _indent << "  return result;\n";
+			}
+			ofs << _indent << "}\n";
+			_leaveProtect( ofs, commandData.protect );
+		}
+		--_indent;
+
+		ofs << "\n"
+			<< _indent << "private:\n";
+
+		++_indent;
+		for( auto& it : tracked )
+		{
+			ofs << _indent << "struct " << _getStateName( it->first ) << "\n"
+				<< _indent << "{\n"
+				<< _indent << "  bool valid;\n";
+			for( size_t i = 1; i < it->second.arguments.size(); i++ )
+			{
+				MemberData const& argument = it->second.arguments[ i ];
+				ofs << _indent << "  ";
+				if( !argument.arraySize.empty() )
+					ofs << _getCType( argument.pureType, vkData ) << " " << argument.name << "[ " << argument.arraySize << " ];\n";
+				else if( argument.type.back() == '*' )
+					ofs << "std::vector<" << _getCType( argument.pureType, vkData ) << "> " << argument.name << ";\n";
+				else
+					ofs << _getCType( argument.type, vkData, argument.pureType ) << " " << argument.name << ";\n";
+			}
+			ofs << _indent << "};\n\n";
+		}
+
+		ofs << _indent << "template <typename State, size_t N>\n"
+			<< _indent << "static void invalidate( State ( &states )[ N ] )\n"
+			<< _indent << "{\n"
+			<< _indent << "  for( size_t i = 0; i < N; i++ )\n"
+			<< _indent << "    states[ i ].valid = false;\n"
+			<< _indent << "}\n\n"
+			<< _indent << "template <typename T>\n"
+			<< _indent << "static bool equal( std::vector<T> const& lhs, T const* rhs, size_t count )\n"
+			<< _indent << "{\n"
+			<< _indent << "  return lhs.size() == count && ( !count || memcmp( lhs.data(), rhs, count * sizeof( T ) ) == 0 );\n"
+			<< _indent << "}\n\n"
+			<< _indent << "CommandBuffer m_commandBuffer;\n"
+			<< _indent << "Dispatch const* m_dispatch;\n";
+		for( auto& it : tracked )
+		{
+			ofs << _indent << "mutable " << _getStateName( it->first ) << " " << _getStateMember( it->first ) << "[ "
+				<< ( _getStateKey( it->second ) ? 2 : 1 ) << " ];\n";
+		}
+		ofs << _indent << "mutable uint64_t m_elided[ " << tracked.size() << " ];\n";
+		--_indent;
+
+		ofs << _indent << "};\n"
+			<< "#endif /*VKCPP_DISABLE_ENHANCED_MODE*/\n\n";
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeStatefulCommand( std::ostream& ofs, SpecData* vkData,
+											  SymbolMap<CommandData>::const_iterator it, size_t index,
+											  std::vector<SymbolMap<CommandData>::const_iterator> const& tracked )
+	{
+		CommandData const& commandData = it->second;
+		std::string callName = "vk" + std::string( 1, static_cast<char>( toupper( it->first[ 0 ] ) ) ) + it->first.substr( 1 );
+		std::string stateName = _getStateName( it->first );
+		MemberData const* key = _getStateKey( commandData );
+
+		ofs << "\n" << _indent << "void " << callName << "( ";
+		_writeDispatchArguments( ofs, vkData, commandData );
+		ofs << " ) const\n"
+			<< _indent << "{\n";
+
+		++_indent;
+		ofs << _indent << "assert( commandBuffer == static_cast<VkCommandBuffer>( m_commandBuffer ) );\n";
+
+		// the pipeline bind points have their own state, the others aren't tracked
+		if( key )
+		{
+			ofs << _indent << stateName << "* state = static_cast<size_t>( " << key->name << " ) < 2 ? &"
+				<< _getStateMember( it->first ) << "[ " << key->name << " ] : nullptr;\n"
+				<< _indent << "if( state && state->valid";
+		}
+		else
+		{
+			ofs << _indent << stateName << "* state = &" << _getStateMember( it->first ) << "[ 0 ];\n"
+				<< _indent << "if( state->valid";
+		}
+		for( size_t i = 1; i < commandData.arguments.size(); i++ )
+		{
+			MemberData const& argument = commandData.arguments[ i ];
+			ofs << "\n" << _indent << "\t&& ";
+			if( !argument.arraySize.empty() )
+				ofs << "memcmp( state->" << argument.name << ", " << argument.name << ", sizeof( state->" << argument.name << " ) ) == 0";
+			else if( argument.type.back() == '*' )
+				ofs << "equal( state->" << argument.name << ", " << argument.name << ", " << _getLenExpression( argument ) << " )";
+			else
+				ofs << "state->" << argument.name << " == " << argument.name;
+		}
+		ofs << " )\n"
+			<< _indent << "{\n"
+			<< _indent << "  m_elided[ " << index << " ]++;\n"
+			<< _indent << "  return;\n"
+			<< _indent << "}\n\n";
+
+		if( it->first == "cmdBindPipeline" )
+		{
+			for( auto& other : tracked )
+			{
+				if( other->first.compare( 0, 6, "cmdSet" ) == 0 )
+					ofs << _indent << "invalidate( " << _getStateMember( other->first ) << " );\n";
+			}
+			ofs << "\n";
+		}
+
+		ofs << _indent << "m_dispatch->" << callName << "( ";
+		for( size_t i = 0; i < commandData.arguments.size(); i++ )
+			ofs << ( i ? ", " : "" ) << commandData.arguments[ i ].name;
+		ofs << " );\n\n";
+
+		ofs << _indent << ( key ? "if( state )\n" : "" )
+			<< _indent << "{\n"
+			<< _indent << "  state->valid = true;\n";
+		for( size_t i = 1; i < commandData.arguments.size(); i++ )
+		{
+			MemberData const& argument = commandData.arguments[ i ];
+			ofs << _indent << "  ";
+			if( !argument.arraySize.empty() )
+				ofs << "memcpy( state->" << argument.name << ", " << argument.name << ", sizeof( state->" << argument.name << " ) );\n";
+			else if( argument.type.back() == '*' )
+				ofs << "state->" << argument.name << ".assign( " << argument.name << ", " << argument.name << " + " << _getLenExpression( argument ) << " );\n";
+			else
+				ofs << "state->" << argument.name << " = " << argument.name << ";\n";
+		}
+		ofs << _indent << "}\n";
+		ofs << --_indent << "}\n";
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeDispatchArguments( std::ostream& ofs, SpecData* vkData, CommandData const& commandData )
+	{
+		for( size_t i = 0; i < commandData.arguments.size(); i++ )
+		{
+			MemberData const& argument = commandData.arguments[ i ];
+			ofs << ( i ? ", " : "" ) << _getCType( argument.type, vkData, argument.pureType ) << " " << argument.name;
+			if( !argument.arraySize.empty() )
+				ofs << "[ " << argument.arraySize << " ]";
+		}
+	}
+	//--------------------------------------------------------------------------
+	std::string CppGenerator::_getStateName( std::string const& commandName ) const
+	{
+		assert( commandName.compare( 0, 3, "cmd" ) == 0 );
+		return commandName.substr( 3 ) + "State";
+	}
+	//--------------------------------------------------------------------------
+	std::string CppGenerator::_getStateMember( std::string const& commandName ) const
+	{
+		assert( commandName.compare( 0, 3, "cmd" ) == 0 );
+		return "m_" + std::string( 1, static_cast<char>( tolower( commandName[ 3 ] ) ) ) + commandName.substr( 4 );
+	}
+	//--------------------------------------------------------------------------
+	MemberData const* CppGenerator::_getStateKey( CommandData const& commandData ) const
+	{
+		for( auto& argument : commandData.arguments )
+		{
+			if( argument.pureType == "PipelineBindPoint" )
+				return &argument;
+		}
+		return nullptr;
+	}
+	//--------------------------------------------------------------------------
+	std::vector<MemberData const*> CppGenerator::_getCopiedMembers( SpecData* vkData, MemberData const& argument ) const
+	{
+		std::vector<MemberData const*> members;
+		auto it = vkData->structs.find( argument.pureType.str() );
+		if( it == vkData->structs.end() )
+			return members;
+
+		for( auto& member : it->second.members )
+		{
+			if( member.type.back() != '*' || member.len.empty() )
+				continue;
+
+			// a string, or an array counted by another member
+			bool counted = member.len == "null-terminated";
+			for( size_t i = 0; i < it->second.members.size() && !counted; i++ )
+				counted = it->second.members[ i ].name == member.len;
+
+			if( counted )
+				members.push_back( &member );
+		}
+		return members;
+	}
+	//--------------------------------------------------------------------------
+	std::string CppGenerator::_getLenExpression( MemberData const& argument ) const
+	{
+		// older specs spell dataSize/4 in latexmath
+		if( argument.len == "latexmath:[$dataSize \\over 4$]" )
+			return "dataSize / 4";
+		return argument.len.str();
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeRecordArgument( std::ostream& ofs, SpecData* vkData, MemberData const& argument )
+	{
+		assert( argument.type.find( "**" ) == std::string::npos );
+		if( !argument.arraySize.empty() )
+			ofs << _indent << "m_stream->write( " << argument.name << ", " << argument.arraySize << " );\n";
+		else if( argument.type.back() != '*' )
+			ofs << _indent << "m_stream->write( &" << argument.name << ", 1 );\n";
+		else if( !argument.len.empty() )
+		{
+			ofs << _indent << "m_stream->write( ";
+			if( argument.pureType == "void" )
+				ofs << "static_cast<uint8_t const*>( " << argument.name << " )";
+			else
+				ofs << argument.name;
+
+			ofs << ", static_cast<size_t>( " << _getLenExpression( argument ) << " ) );\n";
+		}
+		else
+		{
+			// a single element, and the arrays its members point to
+			ofs << _indent << "m_stream->writeArray( " << argument.name << ", " << argument.name << " ? 1 : 0 );\n";
+
+			std::vector<MemberData const*> members = _getCopiedMembers( vkData, argument );
+			if( !members.empty() )
+			{
+				ofs << _indent << "if( " << argument.name << " )\n"
+					<< _indent << "{\n";
+				for( auto member : members )
+				{
+					std::string pointer = argument.name + "->" + member->name.str();
+					ofs << _indent << "  m_stream->writeArray( " << pointer << ", ";
+					if( member->len == "null-terminated" )
+						ofs << pointer << " ? strlen( " << pointer << " ) + 1 : 0";
+					else
+						ofs << argument.name << "->" << member->len;
+
+					ofs << " );\n";
+				}
+				ofs << _indent << "}\n";
+			}
+		}
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeReplayArgument( std::ostream& ofs, SpecData* vkData, MemberData const& argument )
+	{
+		std::string elementType = argument.pureType == "void" ? "uint8_t" : _getCType( argument.pureType, vkData );
+		if( !argument.arraySize.empty() )
+		{
+			ofs << _indent << elementType << " const* " << argument.name << " = arguments.read<"
+				<< elementType << ">( " << argument.arraySize << " );\n";
+		}
+		else if( argument.type.back() != '*' )
+		{
+			std::string cType = _getCType( argument.type, vkData, argument.pureType );
+			ofs << _indent << cType << " " << argument.name << " = *arguments.read<" << cType << ">( 1 );\n";
+		}
+		else if( !argument.len.empty() )
+		{
+			ofs << _indent << elementType << " const* " << argument.name << " = arguments.read<"
+				<< elementType << ">( static_cast<size_t>( " << _getLenExpression( argument ) << " ) );\n";
+		}
+		else
+		{
+			ofs << _indent << elementType << " const* " << argument.name << " = arguments.readArray<" << elementType << ">();\n";
+
+			// point the members of a copy to the arrays which follow
+			std::vector<MemberData const*> members = _getCopiedMembers( vkData, argument );
+			if( !members.empty() )
+			{
+				std::string copy = _reduceName( argument.name );
+				ofs << _indent << elementType << " " << copy << ";\n"
+					<< _indent << "if( " << argument.name << " )\n"
+					<< _indent << "{\n"
+					<< _indent << "  " << copy << " = *" << argument.name << ";\n";
+				for( auto member : members )
+				{
+					std::string memberType = member->pureType == "void" ? "uint8_t" : _getCType( member->pureType, vkData );
+					ofs << _indent << "  " << copy << "." << member->name << " = arguments.readArray<" << memberType << ">();\n";
+				}
+				ofs << _indent << "  " << argument.name << " = &" << copy << ";\n"
+					<< _indent << "}\n";
+			}
+		}
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeDispatchTable( std::ostream& ofs, std::string const& name, std::string const& level,
+											std::vector<SymbolMap<CommandData>::const_iterator> const& commands )
+	{
+		std::vector<std::string> callNames;
+		for( auto& it : commands )
+			callNames.push_back( "vk" + std::string( 1, static_cast<char>( toupper( it->first[ 0 ] ) ) ) + it->first.substr( 1 ) );
+
+		std::string handle = "Vk" + level;
+		std::string getProcAddr = "PFN_vkGet" + level + "ProcAddr getProcAddr = ::vkGet" + level + "ProcAddr";
+
+		ofs << _indent << "struct " << name << "\n"
+			<< _indent << "{\n";
+
+		++_indent;
+		ofs << _indent << name << "() = default;\n\n"
+			<< _indent << "explicit " << name << "( " << handle << " handle, " << getProcAddr << " )\n"
+			<< _indent << "{\n"
+			<< _indent << "  init( handle, getProcAddr );\n"
+			<< _indent << "}\n\n"
+			<< _indent << "void init( " << handle << " handle, " << getProcAddr << " )\n"
+			<< _indent << "{\n";
+
+		for( size_t i = 0; i < commands.size(); i++ )
+		{
+			_enterProtect( ofs, commands[ i ]->second.protect );
+			ofs << _indent << "  " << callNames[ i ] << " = reinterpret_cast<PFN_" << callNames[ i ]
+				<< ">( getProcAddr( handle, \"" << callNames[ i ] << "\" ) );\n";
+			_leaveProtect( ofs, commands[ i ]->second.protect );
+		}
+		ofs << _indent << "}\n\n";
+
+		for( size_t i = 0; i < commands.size(); i++ )
+		{
+			_enterProtect( ofs, commands[ i ]->second.protect );
+			ofs << _indent << "PFN_" << callNames[ i ] << " " << callNames[ i ] << " = nullptr;\n";
+			_leaveProtect( ofs, commands[ i ]->second.protect );
+		}
+		--_indent;
+		ofs << _indent << "};\n\n";
+	}
+	//--------------------------------------------------------------------------
+	std::string CppGenerator::_getCType( std::string const& type, SpecData* vkData,
+										 std::string const& pureType ) const
+	{
+		std::string cType = type;
+		std::string const& name = pureType.empty() ? type : pureType;
+		auto it = vkData->findDependency( name );
+		if( vkData->vkTypes.find( name ) != vkData->vkTypes.end() ||
+			( it != vkData->dependencies.end() && it->category == DependencyData::Category::SCALAR ) )
+		{
+			size_t pos = cType.find( name );
+			assert( pos != std::string::npos );
+			cType.insert( pos, "Vk" );
+		}
+		return cType;
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeEnumsToString( DualOFStream& ofs, SpecData* vkData )
+	{
+		_writeDependencies( ofs, vkData, [vkData]( CppGenerator& writer, DualOFStream& out, DependencyData const& it )
+		{
+			switch( it.category )
+			{
+				case DependencyData::Category::ENUM:
+				{
+					assert( vkData->enums.find( it.name ) != vkData->enums.end() );
+					writer._writeEnumsToString(
+								out,
+								it,
+								vkData->enums.find( it.name )->second
+					);
+				}
+				break;
+
+				case DependencyData::Category::FLAGS:
+					writer._writeFlagsToString(
+								out,
+								it,
+								vkData->enums.find( it.dependencies.front() )->second
+					);
+				break;
+			}
+		} );
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeEnumsToString( DualOFStream& ofs,
+											DependencyData const& dependencyData,
+											EnumData const& enumData )
+	{
+		_enterProtect( ofs, enumData.protect );
+
+		std::vector<std::pair<int64_t, size_t>> values;
+		bool useTable = _stringTables && !enumData.members.empty() && _getEnumValues( enumData, values );
+
+		// the flags are converted bit by bit, through a table indexed by bit position
+		if( useTable && enumData.bitmask )
+			_writeBitNames( ofs, dependencyData, enumData, values );
+
+		// the name itself, out of the string literals, doesn't allocate
+		ofs << _indent;
+		if( !ofs.usingDualStream() )
+			ofs << "inline ";
+
+		ofs << "const char* to_cstring( " << dependencyData.name
+			<< ( enumData.members.empty() ? " )" : " value )" );
+		if( ofs.usingDualStream() )
+			ofs.hdr() << ";";
+
+		ofs << std::endl;
+		ofs.src() << _indent << "{\n";
+
+		if( enumData.members.empty() )
+			ofs.src() << ++_indent << "return \"(void)\";\n";
+		else if( useTable )
+		{
+			++_indent;
+			_writeEnumTable( ofs, dependencyData, enumData, values );
+		}
+		else
+		{
+			ofs.src() << ++_indent << "switch( value )\n" << _indent << "{\n";
+			for( auto& itMember : enumData.members )
+			{
+				ofs.src() << _indent << "case " << dependencyData.name << "::"
+					<< itMember.name << ": return \""
+					<< itMember.name.substr( 1 ) << "\";\n";
+			}
+			ofs.src() << _indent << "default: return \"invalid\";\n" << _indent
+					  << "}\n";
+		}
+		ofs.src() << --_indent << "}\n\n";
+
+		ofs << _indent;
+		if( !ofs.usingDualStream() )
+			ofs << "inline ";
+
+		ofs << "std::string to_string( " << dependencyData.name << " value )";
+		if( ofs.usingDualStream() )
+			ofs.hdr() << ";";
+
+		ofs << std::endl;
+		ofs.src() << _indent << "{\n"
+				  << _indent << "  return to_cstring( value );\n"
+				  << _indent << "}\n\n";
+
+		_writeEnumFromString( ofs, dependencyData, enumData );
+		_leaveProtect( ofs, enumData.protect );
+		ofs << std::endl;
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeEnumFromString( DualOFStream& ofs,
+											 DependencyData const& dependencyData,
+											 EnumData const& enumData )
+	{
+		ofs << _indent;
+		if( !ofs.usingDualStream() )
+			ofs << "inline ";
+
+		ofs << "bool from_string( char const*"
+			<< ( enumData.members.empty() ? ", size_t, " : " text, size_t length, " )
+			<< dependencyData.name << ( enumData.members.empty() ? "& )" : "& value )" );
+		if( ofs.usingDualStream() )
+			ofs.hdr() << ";";
+
+		ofs << std::endl;
+		ofs.src() << _indent << "{\n";
+		if( enumData.members.empty() )
+			ofs.src() << _indent << "  return false;\n";
+		else
+		{
+			// the names as written by to_string, sorted for findEnumValue
+			std::vector<std::pair<std::string, std::string>> names;
+			for( auto& itMember : enumData.members )
+				names.push_back( std::make_pair( itMember.name.substr( 1 ), itMember.name ) );
+
+			std::sort( names.begin(), names.end() );
+
+			ofs.src() << _indent << "  static constexpr EnumName<" << dependencyData.name << "> names[] = {\n";
+			for( auto& it : names )
+				ofs.src() << _indent << "    { " << dependencyData.name << "::" << it.second << ", \"" << it.first << "\" },\n";
+
+			ofs.src() << _indent << "  };\n"
+					  << _indent << "  return findEnumValue( names, text, length, value );\n";
+		}
+		ofs.src() << _indent << "}\n";
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeEnumTable( DualOFStream& ofs,
+										DependencyData const& dependencyData,
+										EnumData const& enumData,
+										std::vector<std::pair<int64_t, size_t>> const& values )
+	{
+		// a bitmask of single bits only is fully described by its bit names
+		bool singleBits = enumData.bitmask;
+		bool dense = true;
+		for( size_t i = 0; i < values.size(); i++ )
+		{
+			singleBits = singleBits && 0 < values[ i ].first && !( values[ i ].first & ( values[ i ].first - 1 ) );
+			dense = dense && values[ i ].first == values[ 0 ].first + static_cast<int64_t>( i );
+		}
+
+		if( singleBits )
+		{
+			ofs.src() << _indent << "char const* name = bit_name( value );\n"
+					  << _indent << "return name ? name : \"invalid\";\n";
+		}
+		else if( dense )
+		{
+			ofs.src() << _indent << "static constexpr char const* names[] = {\n";
+			for( auto& it : values )
+				ofs.src() << _indent << "  \"" << enumData.members[ it.second ].name.substr( 1 ) << "\",\n";
+
+			ofs.src() << _indent << "};\n"
+					  << _indent << "return findEnumName( names, " << dependencyData.name << "::"
+					  << enumData.members[ values[ 0 ].second ].name << ", value );\n";
+		}
+		else
+		{
+			ofs.src() << _indent << "static constexpr EnumName<" << dependencyData.name << "> names[] = {\n";
+			for( auto& it : values )
+			{
+				std::string const& name = enumData.members[ it.second ].name;
+				ofs.src() << _indent << "  { " << dependencyData.name << "::" << name << ", \"" << name.substr( 1 ) << "\" },\n";
+			}
+			ofs.src() << _indent << "};\n"
+					  << _indent << "return findEnumName( names, value );\n";
+		}
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeBitNames( DualOFStream& ofs,
+									   DependencyData const& dependencyData,
+									   EnumData const& enumData,
+									   std::vector<std::pair<int64_t, size_t>> const& values )
+	{
+		// the members covering a single bit, by bit position
+		std::vector<std::string> names;
+		for( auto& it : values )
+		{
+			if( 0 < it.first && it.first <= 0xFFFFFFFFll && !( it.first & ( it.first - 1 ) ) )
+			{
+				size_t bit = 0;
+				while( !( it.first & ( 1ll << bit ) ) )
+					bit++;
+
+				names.resize( std::max( names.size(), bit + 1 ) );
+				if( names[ bit ].empty() )
+					names[ bit ] = enumData.members[ it.second ].name.substr( 1 );
+			}
+		}
+
+		ofs << _indent;
+		if( !ofs.usingDualStream() )
+			ofs << "inline ";
+
+		ofs << "const char* bit_name( " << dependencyData.name << " value )";
+		if( ofs.usingDualStream() )
+			ofs.hdr() << ";";
+
+		ofs << std::endl;
+		ofs.src() << _indent << "{\n";
+		if( names.empty() )
+			ofs.src() << _indent << "  return nullptr;\n";
+		else
+		{
+			ofs.src() << _indent << "  static constexpr char const* names[] = {\n";
+			for( auto& name : names )
+				ofs.src() << _indent << "    " << ( name.empty() ? "nullptr" : "\"" + name + "\"" ) << ",\n";
+
+			ofs.src() << _indent << "  };\n"
+					  << _indent << "  return findBitName( names, static_cast<uint32_t>( value ) );\n";
+		}
+		ofs.src() << _indent << "}\n\n";
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeFlagsToString( DualOFStream& ofs,
+											DependencyData const& dependencyData,
+											EnumData const &enumData )
+	{
+		_enterProtect( ofs, enumData.protect );
+
+		// the text is written to any output iterator, templated, so header only
+		ofs.hdr() << _indent << "template <typename OutputIt>\n"
+				  << _indent << "OutputIt to_string( const " << dependencyData.name
+				  << ( enumData.members.empty() ? "&" : "& value" ) << ", OutputIt out )\n"
+				  << _indent << "{\n";
+		ofs.hdr() << ++_indent << "FlagsWriter<OutputIt> writer( out );\n";
+
+		std::vector<std::pair<int64_t, size_t>> values;
+		if( _stringTables && !enumData.members.empty() && _getEnumValues( enumData, values ) )
+		{
+			// visit the bits set, lowest first
+			ofs.hdr() << _indent << "for( uint32_t mask = static_cast<uint32_t>( value ); mask; mask &= mask - 1 )\n"
+					  << _indent << "{\n"
+					  << _indent << "  char const* name = bit_name( static_cast<" << dependencyData.dependencies.front() << ">( mask & ( 0u - mask ) ) );\n"
+					  << _indent << "  if( name ) writer.add( name );\n"
+					  << _indent << "}\n";
+		}
+		else
+		{
+			std::string enumPrefix = dependencyData.dependencies.front() + "::";
+			for( auto& itMember : enumData.members )
+			{
+				ofs.hdr() << _indent << "if( value & " << enumPrefix + itMember.name
+						  << " ) writer.add( \"" << itMember.name.substr( 1 ) << "\" );\n";
+			}
+		}
+
+		ofs.hdr() << _indent << "return writer.finish();\n";
+		ofs.hdr() << --_indent << "}\n\n";
+
+		// into a char buffer, returns the length of the whole text
+		ofs << _indent;
+		if( !ofs.usingDualStream() )
+			ofs << "inline ";
+
+		ofs << "size_t to_string( const " << dependencyData.name << "& value, char* buffer, size_t size )";
+		if( ofs.usingDualStream() )
+			ofs.hdr() << ";";
+
+		ofs << std::endl;
+		ofs.src() << _indent << "{\n"
+				  << _indent << "  return to_string( value, CharBufferIterator( buffer, size ) ).finish();\n"
+				  << _indent << "}\n\n";
+
+		ofs << _indent;
+		if( !ofs.usingDualStream() )
+			ofs << "inline ";
+
+		ofs << "std::string to_string( const " << dependencyData.name << "& value )";
+		if( ofs.usingDualStream() )
+			ofs.hdr() << ";";
+
+		ofs << std::endl;
+		ofs.src() << _indent << "{\n"
+				  << _indent << "  std::string result;\n"
+				  << _indent << "  to_string( value, std::back_inserter( result ) );\n"
+				  << _indent << "  return result;\n"
+				  << _indent << "}\n";
+		_leaveProtect( ofs, enumData.protect );
+		ofs << std::endl;
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeTypes( DualOFStream& ofs, SpecData* vkData,
+									std::map<std::string, std::string> const& defaultValues )
+	{
+		_writeDependencies( ofs, vkData, [vkData, &defaultValues]( CppGenerator& writer, DualOFStream& out, DependencyData const& it )
+		{
+			switch( it.category )
+			{
+				case DependencyData::Category::COMMAND:
+					writer._writeTypeCommand( out.hdr(), vkData, it );
+					break;
+
+				case DependencyData::Category::ENUM:
+					assert( vkData->enums.find( it.name ) != vkData->enums.end() );
+					writer._writeTypeEnum( out.hdr(), it, vkData->enums.find( it.name )->second );
+					break;
+
+				case DependencyData::Category::FLAGS:
+					assert( vkData->flags.find( it.name ) != vkData->flags.end() );
+					writer._writeTypeFlags( out, it, vkData->flags.find( it.name )->second );
+					break;
+
+				case DependencyData::Category::FUNC_POINTER:
+				case DependencyData::Category::REQUIRED:
+					// skip FUNC_POINTER and REQUIRED, they just needed to be in the dependencies list to resolve dependencies
+					break;
+
+				case DependencyData::Category::HANDLE:
+					assert( vkData->handles.find( it.name ) != vkData->handles.end() );
+					writer._writeTypeHandle( out, vkData, it, vkData->handles.find( it.symbol )->second );
+					break;
+
+				case DependencyData::Category::SCALAR:
+					writer._writeTypeScalar( out.hdr(), it );
+					break;
+
+				case DependencyData::Category::STRUCT:
+					writer._writeTypeStruct( out, vkData, it, defaultValues );
+					break;
+
+				case DependencyData::Category::UNION:
+					assert( vkData->structs.find( it.name ) != vkData->structs.end() );
+					writer._writeTypeUnion( out, vkData, it, vkData->structs.find( it.name )->second, defaultValues );
+					break;
+
+				default:
+					assert( false );
+					break;
+			}
+		} );
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeDependencies( DualOFStream& ofs, SpecData* vkData,
+										   DependencyWriter const& write )
+	{
+		if( _threads <= 1 )
+		{
+			for( auto& it : vkData->dependencies )
+				write( *this, ofs, it );
+
+			return;
+		}
+
+		std::vector<DependencyData const*> dependencies;
+		for( auto& it : vkData->dependencies )
+			dependencies.push_back( &it );
+
+		// every entry is rendered by its own copy of this generator, which
+		// gives each task a private indent, then appended in the sorted order
+		std::vector<std::unique_ptr<DualOFStream>> parts( dependencies.size() );
+		parallelFor( dependencies.size(), _threads, [&]( size_t i )
+		{
+			CppGenerator writer( *this );
+			parts[ i ].reset( new DualOFStream( ofs.usingDualStream() ) );
+			write( writer, *parts[ i ], *dependencies[ i ] );
+		} );
+
+		for( auto& part : parts )
+			ofs.append( *part );
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeTypeCommand( std::ostream& ofs, SpecData* vkData,
+										  DependencyData const& dependencyData ) const
+	{
+		auto it = vkData->commands.find( dependencyData.name );
+		assert( it != vkData->commands.end() );
+		auto& commandData = it->second;
+		if( !commandData.handleCommand )
+		{
+			_writeTypeCommandStandard( ofs, dependencyData.name, dependencyData, commandData, vkData->vkTypes );
+
+			ofs << "\n#ifndef VKCPP_DISABLE_ENHANCED_MODE\n";
+			_writeTypeCommandEnhanced( ofs, vkData, "", dependencyData.name, dependencyData, commandData );
+			ofs << "#endif /*VKCPP_DISABLE_ENHANCED_MODE*/\n\n";
+		}
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeTypeCommandStandard( std::ostream& ofs,
+												  std::string const& functionName,
+												  DependencyData const& dependencyData,
+												  CommandData const& commandData,
+												  std::set<std::string> const& vkTypes ) const
+	{
+		_enterProtect( ofs, commandData.protect );
+		ofs << _indent;
+		if( !commandData.handleCommand )
+			ofs << "inline ";
+		else
+			ofs << "template <typename Dispatch = VK_CPP_DEFAULT_DISPATCH>\n" << _indent;
+
+		ofs << commandData.returnType << " " << functionName << "( ";
+		bool argEncountered = false;
+		for( size_t i = commandData.handleCommand ? 1 : 0; i < commandData.arguments.size(); i++ )
+		{
+			if( argEncountered )
+				ofs << ", ";
+
+			ofs << commandData.arguments[ i ].type << " " << commandData.arguments[ i ].name;
+			if( !commandData.arguments[ i ].arraySize.empty() )
+				ofs << "[ " << commandData.arguments[ i ].arraySize << " ]";
+
+			argEncountered = true;
+		}
+		if( commandData.handleCommand )
+			ofs << ( argEncountered ? ", " : "" ) << "Dispatch const& d = DefaultDispatch<Dispatch>::dispatch";
+
+		ofs << " )";
+		if( commandData.handleCommand )
+			ofs << " const";
+
+		ofs << std::endl << _indent << "{\n" << _indent << "  ";
+
+		bool castReturn = false;
+		if( commandData.returnType != "void" )
+		{
+			ofs << "return ";
+			castReturn = ( vkTypes.find( commandData.returnType ) != vkTypes.end() );
+			if( castReturn )
+				ofs << "static_cast<" << commandData.returnType << ">( ";
+		}
+
+		std::string callName( dependencyData.name );
+		assert( islower( callName[ 0 ] ) );
+		callName[ 0 ] = toupper( callName[ 0 ] );
+
+		if( commandData.handleCommand )
+			ofs << "d.";
+
+		ofs << "vk" << callName << "( ";
+		if( commandData.handleCommand )
+			ofs << "m_" << commandData.arguments[ 0 ].name;
+
+		argEncountered = false;
+		for( size_t i = commandData.handleCommand ? 1 : 0; i < commandData.arguments.size(); i++ )
+		{
+			if( 0 < i )
+				ofs << ", ";
+
+			_writeMemberData( ofs, commandData.arguments[ i ], vkTypes );
+		}
+		ofs << " )";
+		if( castReturn )
+			ofs << " )";
+
+		ofs << ";\n" << _indent << "}\n";
+		_leaveProtect( ofs, commandData.protect );
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeTypeCommandEnhanced( std::ostream& ofs, SpecData* vkData,
+												  std::string const& className,
+												  std::string const& functionName,
+												  DependencyData const& dependencyData,
+												  CommandData const& commandData ) const
+	{
+		_enterProtect( ofs, commandData.protect );
+		std::map<size_t, size_t> vectorParameters = _getVectorParameters( commandData );
+		size_t returnIndex = _findReturnIndex( commandData, vectorParameters );
+		size_t templateIndex = _findTemplateIndex( commandData, vectorParameters );
+		auto returnVector = vectorParameters.find( returnIndex );
+		std::string returnType = _determineReturnType( commandData, returnIndex, returnVector != vectorParameters.end() );
+
+		// short enumerations return a SmallVector, unless an Allocator is given
+		size_t inlineCapacity = commandData.twoStep ? _determineInlineCapacity( dependencyData.name ) : 0;
+		std::string resultType = returnType;
+		if( inlineCapacity )
+			resultType = "typename ResultVector<" + returnType.substr( 12, returnType.find( ',' ) - 12 ) + ", Allocator>::type";
+
+		_writeFunctionHeader( ofs, vkData, resultType, functionName, commandData, returnIndex, templateIndex, vectorParameters, TwoStepTarget::NEW_VECTOR, inlineCapacity );
+		_writeFunctionBody( ofs, className, functionName, resultType, templateIndex, dependencyData, commandData, vkData->vkTypes, returnIndex, vectorParameters );
+
+		// the allocation free overloads
+		if( commandData.twoStep )
+		{
+			for( auto target : { TwoStepTarget::REUSED_VECTOR, TwoStepTarget::BUFFER } )
+			{
+				ofs << std::endl;
+				_writeFunctionHeader( ofs, vkData, returnType, functionName, commandData, returnIndex, templateIndex, vectorParameters, target );
+				_writeFunctionBody( ofs, className, functionName, returnType, templateIndex, dependencyData, commandData, vkData->vkTypes, returnIndex, vectorParameters, target );
+			}
+		}
+		_leaveProtect( ofs, commandData.protect );
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeTypeEnum( std::ostream& ofs,
+									   DependencyData const& dependencyData,
+									   EnumData const& enumData )
+	{
+		_enterProtect( ofs, enumData.protect );
+		ofs << _indent << "enum class " << dependencyData.name;
+		if( enumData.members.empty() )
+			ofs << " {};\n";
+		else
+		{
+			ofs << "\n" << _indent << "{\n";
+			++_indent;
+			for( size_t i = 0; i < enumData.members.size(); i++ )
+			{
+				ofs << _indent << enumData.members[ i ].name << " = "
+					<< enumData.members[ i ].value << std::endl;
+			}
+			ofs << --_indent << "};\n";
+		}
+		_leaveProtect( ofs, enumData.protect );
+		ofs << std::endl;
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeTypeFlags( DualOFStream& ofs,
+										DependencyData const& dependencyData,
+										FlagData const& flagData )
+	{
+		assert( dependencyData.dependencies.size() == 1 );
+		_enterProtect( ofs, flagData.protect );
+		auto& firstDep = dependencyData.dependencies.front();
+		auto& depName = dependencyData.name;
+
+		ofs.hdr() << _indent
+				  << "using " << depName << " = Flags<" << firstDep
+				  << ", Vk" << depName << ">;\n\n";
+
+		// a constexpr operator has to be defined in the header
+		DualOFStream inlineOfs( false );
+		DualOFStream& opOfs = _constexprTypes ? inlineOfs : ofs;
+
+		opOfs << _indent;
+		if( _constexprTypes )
+			opOfs << "VK_CPP_CONSTEXPR ";
+
+		if( !opOfs.usingDualStream() )
+			opOfs << "inline ";
+
+		opOfs << depName << " operator|( " << firstDep << " bit0, " << firstDep << " bit1 )";
+		if( opOfs.usingDualStream() )
+			opOfs.hdr() << ";";
+
+		opOfs << std::endl;
+		opOfs.src() << _indent << "{\n";
+		opOfs.src() << _indent + 1 << "return " << depName << "( bit0 ) | bit1;\n";
+		opOfs.src() << _indent << "}\n";
+
+		if( _constexprTypes )
+			ofs.appendHeader( inlineOfs );
+
+		_leaveProtect( ofs, flagData.protect );
+		ofs << std::endl;
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeTypeHandle( DualOFStream& ofs, SpecData* vkData,
+										 DependencyData const& dependencyData,
+										 HandleData const& handle )
+	{
+		std::string memberName = dependencyData.name;
+		assert( isupper( memberName[ 0 ] ) );
+		memberName[ 0 ] = tolower( memberName[ 0 ] );
+
+		_writeComment( ofs.hdr(), dependencyData.name, "class" );
+		ofs.hdr() << _indent << "class " << dependencyData.name
+				  << "\n" << _indent << "{\n" << _indent << "public:\n";
+
+		// constexpr constructors have to be defined in the header
+		DualOFStream inlineOfs( false );
+		DualOFStream& ctorOfs = _constexprTypes ? inlineOfs : ofs;
+		char const* constexprPrefix = _constexprTypes ? "VK_CPP_CONSTEXPR " : "";
+
+		ctorOfs << ++_indent << constexprPrefix << dependencyData.name;
+
+		if( ctorOfs.usingDualStream() )
+		{
+			ctorOfs.hdr() << "();";
+			ctorOfs.src() << "::" << dependencyData.name << "()";
+		}
+		else
+			ctorOfs.hdr() << "()";
+
+		ctorOfs << std::endl;
+		ctorOfs.src() << ++_indent << ": m_" << memberName << "( VK_NULL_HANDLE )\n";
+		ctorOfs.src() << --_indent << "{}\n\n";
+
+		ctorOfs << "#ifdef VK_CPP_TYPESAFE_CONVERSION\n" << _indent << constexprPrefix;
+		// construct from native handle
+		if( ctorOfs.usingDualStream() )
+			ctorOfs.src() << dependencyData.name << "::";
+
+		ctorOfs << dependencyData.name << "( Vk" << dependencyData.name << " " << memberName << " )";
+
+		if( ctorOfs.usingDualStream() )
+			ctorOfs.hdr() << ";";
+
+		ctorOfs << std::endl;
+		ctorOfs.src() << ++_indent << ": m_" << memberName << "( " << memberName << " )\n";
+		ctorOfs.src() << --_indent << "{}\n\n";
+
+		// assignment from native handle
+		ctorOfs << _indent << dependencyData.name << "& ";
+		if( ctorOfs.usingDualStream() )
+			ctorOfs.src() << dependencyData.name << "::";
+
+		ctorOfs << "operator=( Vk" << dependencyData.name << " " << memberName << " )";
+
+		if( ctorOfs.usingDualStream() )
+			ctorOfs.hdr() << ";";
+
+		ctorOfs << std::endl;
+		ctorOfs.src() << _indent << "{\n";
+		ctorOfs.src() << ++_indent << "m_" << memberName << " = " << memberName << ";\n"
+					  << _indent << "return *this;\n";
+		ctorOfs.src() << --_indent << "}\n";
+
+		ctorOfs.hdr() << "#else\n";
+
+		ctorOfs.hdr() << _indent << "explicit\n";
+		ctorOfs << ( _indent -= 2 ) << "#endif\n";
+
+		if( _constexprTypes )
+			ofs.appendHeader( inlineOfs );
+
+		ofs << ( _indent += 2 );
+		if( ofs.usingDualStream() )
+			ofs.src() << dependencyData.name << "::";
+
+		ofs << "operator Vk" << dependencyData.name << "() const";
+		if( ofs.usingDualStream() )
+			ofs.hdr() << ";";
+
+		ofs << std::endl;
+		ofs.src() << _indent << "{\n";
+		ofs.src() << ++_indent << "return m_" << memberName << ";\n";
+		ofs.src() << --_indent << "}\n\n";
+
+		if( !handle.commands.empty() )
+		{
+			for( size_t i = 0; i < handle.commands.size(); i++ )
+			{
+				SymbolTable::Id commandSymbol = vkData->symbols.find( handle.commands[ i ] );
+				auto cit = vkData->commands.find( commandSymbol );
+				assert( cit != vkData->commands.end() && cit->second.handleCommand );
+				auto dep = vkData->findDependency( commandSymbol );
+				assert( dep != vkData->dependencies.end() );
+				std::string className = dependencyData.name;
+				std::string functionName = _determineFunctionName( dep->name, cit->second );
+
+				bool hasPointers = _hasPointerArguments( cit->second );
+				if( !hasPointers )
+					ofs << "#ifdef VKCPP_DISABLE_ENHANCED_MODE\n";
+
+				_writeTypeCommandStandard( ofs.hdr(), functionName, *dep, cit->second, vkData->vkTypes );
+				if( !hasPointers )
+					ofs << "#endif /*!VKCPP_DISABLE_ENHANCED_MODE*/\n";
+
+				ofs << "\n#ifndef VKCPP_DISABLE_ENHANCED_MODE\n";
+				_writeTypeCommandEnhanced( ofs.hdr(), vkData, className, functionName, *dep, cit->second );
+				ofs << "#endif /*VKCPP_DISABLE_ENHANCED_MODE*/\n";
+
+				if( i < handle.commands.size() - 1 )
+					ofs << std::endl;
+			}
+			ofs << std::endl;
+		}
+
+		ofs.hdr() << _indent << "explicit ";
+		if( ofs.usingDualStream() )
+			ofs.src() << _indent << dependencyData.name << "::";
+
+		ofs << "operator bool() const";
+		if( ofs.usingDualStream() )
+			ofs.hdr() << ";";
+
+		ofs << std::endl;
+		ofs.src() << _indent << "{\n";
+		ofs.src() << ++_indent << "return m_" << memberName << " != VK_NULL_HANDLE;\n";
+		ofs.src() << --_indent << "}\n\n";
+
+		ofs << _indent << "bool ";
+		if( ofs.usingDualStream() )
+			ofs.src() << dependencyData.name << "::";
+
+		ofs << "operator!() const";
+		if( ofs.usingDualStream() )
+			ofs.hdr() << ";";
+
+		ofs << std::endl;
+		ofs.src() << _indent  << "{\n";
+		ofs.src() << ++_indent << "return m_" << memberName << " == VK_NULL_HANDLE;\n";
+		ofs.src() << --_indent << "}\n\n";
+
+		ofs.hdr() << --_indent << "private:\n";
+		ofs.hdr() << _indent + 1 << "Vk" << dependencyData.name << " m_" << memberName << ";\n";
+		ofs.hdr() << _indent << "};\n";
+	#if 1
+		ofs.src() << _indent << "static_assert( sizeof( " << dependencyData.name
+				  << " ) == sizeof( Vk" << dependencyData.name
+				  << " ), \"handle and wrapper have different size!\" );\n";
+	#endif
+		ofs << std::endl;
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeTypeScalar( std::ostream& ofs,
+										 DependencyData const& dependencyData ) const
+	{
+		assert( dependencyData.dependencies.size() == 1 );
+		ofs << _indent << "using " << dependencyData.name << " = "
+			<< dependencyData.dependencies.front() << ";\n\n";
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeTypeStruct( DualOFStream& ofs, SpecData* vkData,
+										 DependencyData const& dependencyData,
+										 std::map<std::string, std::string> const& defaultValues )
+	{
+		auto it = vkData->structs.find( dependencyData.name );
+		assert( it != vkData->structs.end() );
+
+		_enterProtect( ofs, it->second.protect );
+
+		_writeComment( ofs.hdr(), dependencyData.name, "struct" );
+		ofs.hdr() << _indent << "struct " << dependencyData.name << std::endl
+			<< _indent << "{\n";
+
+		// constexpr constructors and setters have to be defined in the header
+		DualOFStream inlineOfs( false );
+		DualOFStream& memberOfs = _constexprTypes ? inlineOfs : ofs;
+
+		// only structs that are not returnedOnly get a constructor!
+		if( !it->second.returnedOnly )
+		{
+			_writeStructConstructor(
+						memberOfs,
+						dependencyData.name,
+						it->second,
+						vkData->vkTypes,
+						defaultValues
+			);
+		}
+
+		// create the setters
+		if( !it->second.returnedOnly )
+		{
+			for( size_t i = 0; i < it->second.members.size(); i++ )
+			{
+				_writeStructSetter(
+							memberOfs,
+							dependencyData.name,
+							it->second.members[ i ],
+							vkData->vkTypes
+				);
+			}
+		}
+
+		if( _constexprTypes )
+			ofs.appendHeader( inlineOfs );
+
+		// the cast-operator to the wrapped struct
+		ofs << ++_indent;
+		if( ofs.usingDualStream() )
+			ofs.src() << dependencyData.name << "::";
+
+		ofs << "operator const Vk" << dependencyData.name << "&() const";
+
+		if( ofs.usingDualStream() )
+			ofs.hdr() << ";";
+
+		ofs << std::endl;
+		ofs.src() << _indent << "{\n"
+				  << _indent + 1 << "return *reinterpret_cast<const Vk"
+				  << dependencyData.name << "*>( this );\n" << _indent << "}\n\n";
+
+		// the member variables
+		for( size_t i = 0; i < it->second.members.size(); i++ )
+		{
+			if( it->second.members[ i ].type == "StructureType" )
+			{
+				assert( i == 0 && it->second.members[ i ].name == "sType" );
+				ofs.hdr() << _indent - 1 << "private:\n"
+					<< _indent << "StructureType sType;\n\n"
+					<< _indent - 1 << "public:\n";
+			}
+			else
+			{
+				ofs.hdr() << _indent << it->second.members[ i ].type << " "
+						  << it->second.members[ i ].name;
+
+				if( !it->second.members[ i ].arraySize.empty() )
+					ofs.hdr() << "[ " << it->second.members[ i ].arraySize << " ]";
+
+				ofs.hdr() << ";\n";
+			}
+		}
+		ofs.hdr() << --_indent << "};\n";
+	#if 1
+		ofs.src() << _indent << "static_assert( sizeof( " << dependencyData.name
+			<< " ) == sizeof( Vk" << dependencyData.name
+			<< " ), \"struct and wrapper have different size!\" );" << std::endl;
+	#endif
+		ofs.src() << "#ifdef VK_CPP_HAS_TRIVIALLY_COPYABLE\n"
+				  << _indent << "static_assert( std::is_trivially_copyable<" << dependencyData.name
+				  << ">::value, \"struct wrapper is not trivially copyable!\" );\n"
+				  << "#endif\n";
+		_leaveProtect( ofs, it->second.protect );
+		ofs << std::endl;
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeTypeUnion( DualOFStream& ofs, SpecData* vkData,
+										DependencyData const& dependencyData,
+										StructData const& unionData,
+										std::map<std::string, std::string> const& defaultValues )
+	{
+		//Unused variable
+		//std::ostringstream oss;
+		_writeComment( ofs.hdr(), dependencyData.name, "union" );
+		ofs.hdr() << _indent << "union " << dependencyData.name << std::endl
+			<< _indent << "{\n";
+
+		// constexpr constructors and setters have to be defined in the header
+		DualOFStream inlineOfs( false );
+		DualOFStream& memberOfs = _constexprTypes ? inlineOfs : ofs;
+
+		++_indent;
+		for( size_t i = 0; i < unionData.members.size(); i++ )
+		{
+			memberOfs << _indent;
+			if( _constexprTypes )
+				memberOfs << "VK_CPP_CONSTEXPR ";
+
+			// one constructor per union element
+			if( memberOfs.usingDualStream() )
+				memberOfs.src() << dependencyData.name << "::";
+
+			memberOfs << dependencyData.name << "( ";
+			if( unionData.members[ i ].arraySize.empty() )
+				memberOfs << unionData.members[ i ].type << " ";
+
+			else
+				memberOfs << "const std::array<" << unionData.members[ i ].type << ", " << unionData.members[ i ].arraySize << ">& ";
+
+			memberOfs << unionData.members[ i ].name << "_";
+
+			// just the very first constructor gets default arguments
+			if( i == 0 )
+			{
+				auto it = defaultValues.find( unionData.members[ i ].pureType );
+				assert( it != defaultValues.end() );
+				if( unionData.members[ i ].arraySize.empty() )
+					memberOfs.hdr() << " = " << it->second;
+				else
+					memberOfs.hdr() << " = { " << it->second << " }";
+			}
+			memberOfs << " )";
+
+			if( memberOfs.usingDualStream() )
+				memberOfs.hdr() << ";";
+
+			memberOfs << std::endl;
+			if( _constexprTypes )
+			{
+				// a constexpr constructor initializes the element it activates
+				memberOfs.src() << _indent + 1 << ": ";
+				_writeMemberInitializer( memberOfs.src(), unionData.members[ i ] );
+				memberOfs.src() << "\n" << _indent << "{}\n\n";
+				continue;
+			}
+
+			memberOfs.src() << _indent << "{\n";
+			memberOfs.src() << _indent + 1;
+
+			if( unionData.members[ i ].arraySize.empty() )
+				memberOfs.src() << unionData.members[ i ].name << " = " << unionData.members[ i ].name << "_";
+			else
+			{
+				memberOfs.src() << "memcpy( &" << unionData.members[ i ].name << ", "
+								<< unionData.members[ i ].name << "_.data(), "
+								<< unionData.members[ i ].arraySize
+								<< " * sizeof( " << unionData.members[ i ].type << " ) )";
+			}
+			memberOfs.src() << ";\n" <<_indent << "}\n\n";
+		}
+
+		for( size_t i = 0; i < unionData.members.size(); i++ )
+		{
+			// one setter per union element
+			assert( !unionData.returnedOnly );
+			_writeStructSetter( memberOfs, dependencyData.name, unionData.members[ i ], vkData->vkTypes );
+		}
+
+		if( _constexprTypes )
+			ofs.appendHeader( inlineOfs );
+
+		// the implicit cast operator to the native type
+		ofs << _indent;
+		if( ofs.usingDualStream() )
+			ofs.src() << dependencyData.name << "::";
+
+		ofs << "operator Vk" << dependencyData.name << " const& () const";
+
+		if( ofs.usingDualStream() )
+			ofs.hdr() << ";";
+
+		ofs << std::endl;
+		ofs.src() << _indent << "{\n"
+				  << _indent + 1 << "return *reinterpret_cast<const Vk" << dependencyData.name << "*>( this );\n"
+				  << _indent << "}\n\n";
+
+		// the union member variables
+		// if there's at least one Vk... type in this union, check for unrestricted unions support
+		bool needsUnrestrictedUnions = false;
+		for( size_t i = 0; i < unionData.members.size() && !needsUnrestrictedUnions; i++ )
+			needsUnrestrictedUnions = vkData->vkTypes.find( unionData.members[ i ].type ) != vkData->vkTypes.end();
+
+		if( needsUnrestrictedUnions )
+		{
+			ofs.hdr() << "#ifdef VK_CPP_HAS_UNRESTRICTED_UNIONS\n";
+			for( size_t i = 0; i < unionData.members.size(); i++ )
+			{
+				ofs.hdr() << _indent << unionData.members[ i ].type << " " << unionData.members[ i ].name;
+				if( !unionData.members[ i ].arraySize.empty() )
+					ofs.hdr() << "[ " << unionData.members[ i ].arraySize << " ]";
+
+				ofs.hdr() << ";\n";
+			}
+			ofs.hdr() << "#else\n";
+		}
+		for( size_t i = 0; i < unionData.members.size(); i++ )
+		{
+			ofs.hdr() << _indent;
+			if( vkData->vkTypes.find( unionData.members[ i ].type ) != vkData->vkTypes.end() )
+				ofs.hdr() << "Vk";
+
+			ofs.hdr() << unionData.members[ i ].type << " " << unionData.members[ i ].name;
+			if( !unionData.members[ i ].arraySize.empty() )
+				ofs.hdr() << "[ " << unionData.members[ i ].arraySize << " ]";
+
+			ofs.hdr() << ";\n";
+		}
+		if( needsUnrestrictedUnions )
+			ofs.hdr() << "#endif // VK_CPP_HAS_UNRESTRICTED_UNIONS\n";
+
+		ofs.hdr() << --_indent << "};\n\n";
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeStructConstructor( DualOFStream& ofs,
+												std::string const& name,
+												StructData const& structData,
+												std::set<std::string> const& /*vkTypes*/, //Unused variable
+												std::map<std::string,
+												std::string> const& defaultValues )
+	{
+		// the constructor with all the elements as arguments, with defaults
+		ofs << ++_indent;
+		if( _constexprTypes )
+			ofs << "VK_CPP_CONSTEXPR ";
+
+		if( ofs.usingDualStream() )
+			ofs.src() << name << "::";
+
+		ofs << name << "( ";
+		bool listedArgument = false;
+		for( size_t i = 0; i < structData.members.size(); i++ )
+		{
+			if( listedArgument )
+				ofs << ", ";
+
+			if( structData.members[ i ].name == "pNext"
+				|| structData.members[ i ].name == "sType" )
+				continue;
+
+			auto defaultIt = defaultValues.find( structData.members[ i ].pureType );
+			assert( defaultIt != defaultValues.end() );
+			if( structData.members[ i ].arraySize.empty() )
+			{
+				ofs << structData.members[ i ].type << " "
+					<< structData.members[ i ].name << "_";
+
+				ofs.hdr() << " = " << ( structData.members[ i ].type.back() == '*' ? "nullptr" : defaultIt->second );
+			}
+			else
+			{
+				ofs << "std::array<" << structData.members[ i ].type << ", "
+					<< structData.members[ i ].arraySize << "> const& "
+					<< structData.members[ i ].name << "_";
+
+				ofs.hdr() << " = { " << defaultIt->second;
+
+				size_t n = atoi( structData.members[ i ].arraySize.str().c_str() );
+				assert( 0 < n );
+				for( size_t j = 1; j < n; j++ )
+					ofs.hdr() << ", " << defaultIt->second;
+
+				ofs.hdr() << " }";
+			}
+			listedArgument = true;
+		}
+		ofs << " )";
+		if( ofs.usingDualStream() )
+			ofs.hdr() << ";";
+
+		ofs << std::endl;
+
+		// copy over the simple arguments, and the arrays too for a constexpr constructor
+		bool firstArgument = true;
+		++_indent;
+		for( size_t i = 0; i < structData.members.size(); i++ )
+		{
+			if( !structData.members[ i ].arraySize.empty() && !_constexprTypes )
+				continue;
+
+			ofs.src() << _indent << ( firstArgument ? ": " : ", " );
+			if( structData.members[ i ].name == "pNext" )
+				ofs.src() << "pNext( nullptr )";
+
+			else if( structData.members[ i ].name == "sType" )
+				ofs.src() << "sType( StructureType::e" << name << " )";
+
+			else
+				_writeMemberInitializer( ofs.src(), structData.members[ i ] );
+
+			ofs.src() << "\n";
+			firstArgument = false;
+		}
+		--_indent;
+
+		// the body of the constructor, copying over data from argument list into wrapped struct
+		if( structData.members.empty() || _constexprTypes )
+			ofs.src() << _indent << "{}\n\n";
+		else
+		{
+			ofs.src() << _indent << "{\n";
+			++_indent;
+			for( size_t i = 0; i < structData.members.size(); i++ )
+			{
+				if( structData.members[ i ].arraySize.empty() )
+					continue;
+
+				ofs.src() << _indent << "memcpy( &" << structData.members[ i ].name
+						  << ", " << structData.members[ i ].name << "_.data(), "
+						  << structData.members[ i ].arraySize
+						  << " * sizeof( " << structData.members[ i ].type << " ) );\n";
+			}
+			ofs.src() << --_indent << "}\n\n";
+		}
+
+		// the copy constructor from a native struct (Vk...), the layouts are
+		// the same, so it's the trivial copy constructor of the wrapper
+		ofs << _indent;
+		if( ofs.usingDualStream() )
+			ofs.src() << name << "::";
+
+		ofs << name << "( Vk" << name << " const& rhs )";
+		if( ofs.usingDualStream() )
+			ofs.hdr() << ";";
+
+		ofs << std::endl;
+		ofs.src() << _indent + 1 << ": " << name << "( reinterpret_cast<" << name << " const&>( rhs ) )\n"
+				  << _indent << "{}\n\n";
+
+		// the assignment operator from a native sturct (Vk...)
+		ofs << _indent << name << "& ";
+		if( ofs.usingDualStream() )
+			ofs.src() << name << "::";
+
+		ofs << "operator=( Vk" << name << " const& rhs )";
+		if( ofs.usingDualStream() )
+			ofs.hdr() << ";";
+
+		ofs << std::endl;
+		ofs.src() << _indent << "{\n"
+				  << _indent + 1 << "return *this = reinterpret_cast<" << name << " const&>( rhs );\n"
+				  << _indent << "}\n\n";
+
+		--_indent;
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeStructSetter( DualOFStream& ofs,
+										   std::string const& name,
+										   MemberData const& memberData,
+										   std::set<std::string> const& /*vkTypes*/ ) //Unused variable
+	{
+		ofs << ++_indent;
+		if( _constexprTypes )
+			ofs << "VK_CPP_CONSTEXPR ";
+
+		ofs << name << "& ";
+		if( ofs.usingDualStream() )
+			ofs.src() << name << "::";
+
+		ofs << "set" << static_cast<char>( toupper( memberData.name[ 0 ] ) )
+			<< memberData.name.substr( 1 ) << "( ";
+
+		if( memberData.arraySize.empty() )
+			ofs << memberData.type << " ";
+
+		else
+			ofs << "const std::array<" << memberData.type << ", " << memberData.arraySize << ">& ";
+
+		ofs << memberData.name << "_ )";
+
+		if( ofs.usingDualStream() )
+			ofs.hdr() << ";";
+
+		ofs << std::endl;
+		ofs.src() << _indent << "{\n";
+
+		if( !memberData.arraySize.empty() && _constexprTypes )
+		{
+			ofs.src() << _indent + 1 << "for( size_t i = 0; i < " << memberData.arraySize << "; i++ )\n"
+					  << _indent + 2 << memberData.name << "[ i ] = " << memberData.name << "_[ i ]";
+		}
+		else if( !memberData.arraySize.empty() )
+		{
+			ofs.src() << _indent + 1 << "memcpy( &" << memberData.name << ", "
+					  << memberData.name << "_.data(), " << memberData.arraySize
+					  << " * sizeof( " << memberData.type << " ) )";
+		}
+		else
+			ofs.src() << _indent + 1 << memberData.name << " = " << memberData.name << "_";
+
+		ofs.src() << ";\n" << _indent + 1 << "return *this;\n";
+		ofs.src() << _indent << "}\n\n";
+		--_indent;
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeMemberInitializer( std::ostream& ofs, MemberData const& memberData ) const
+	{
+		if( memberData.arraySize.empty() )
+		{
+			ofs << memberData.name << "( " << memberData.name << "_ )";
+			return;
+		}
+
+		// an array is initialized element by element
+		size_t n = atoi( memberData.arraySize.str().c_str() );
+		assert( 0 < n );
+
+		ofs << memberData.name << "{ ";
+		for( size_t j = 0; j < n; j++ )
+			ofs << ( j ? ", " : "" ) << memberData.name << "_[ " << j << " ]";
+
+		ofs << " }";
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeMemberData( std::ostream& ofs,
+										 MemberData const& memberData,
+										 std::set<std::string> const& vkTypes ) const
+	{
+		if( vkTypes.find( memberData.pureType ) != vkTypes.end() )
+		{
+			if( memberData.type.back() == '*' )
+			{
+				ofs << "reinterpret_cast<";
+				if( memberData.type.find( "const" ) == 0 )
+					ofs << "const ";
+
+				ofs << "Vk" << memberData.pureType << '*';
+			}
+			else
+				ofs << "static_cast<Vk" << memberData.pureType;
+
+			ofs << ">( " << memberData.name << " )";
+		}
+		else
+			ofs << memberData.name;
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeFunctionHeader( std::ostream& ofs, SpecData* vkData,
+											 std::string const& returnType,
+											 std::string const& name,
+											 CommandData const& commandData,
+											 size_t returnIndex,
+											 size_t templateIndex,
+											 std::map<size_t, size_t> const& vectorParameters,
+											 TwoStepTarget target,
+											 size_t inlineCapacity ) const
+	{
+		assert( target == TwoStepTarget::NEW_VECTOR || commandData.twoStep );
+		std::set<size_t> skippedArguments;
+		for( auto& it : vectorParameters )
+		{
+			if( it.second != ~0 )
+				skippedArguments.insert( it.second );
+		}
+		if( vectorParameters.size() == 1
+			&& ( commandData.arguments[ vectorParameters.begin()->first ].len == "dataSize/4"
+				 || commandData.arguments[ vectorParameters.begin()->first ].len == "latexmath:[$dataSize \\over 4$]" ) )
+		{
+			assert( commandData.arguments[ 3 ].name == "dataSize" );
+			skippedArguments.insert( 3 );
+		}
+		if( returnIndex != ~0 && target == TwoStepTarget::NEW_VECTOR )
+			skippedArguments.insert( returnIndex );
+
+		// the count is an argument of its own when filling a buffer
+		size_t countIndex = commandData.twoStep ? vectorParameters.find( returnIndex )->second : ~0;
+		if( target == TwoStepTarget::BUFFER )
+			skippedArguments.erase( countIndex );
+
+		// the type of the enumerated values
+		std::string valueType;
+		if( returnType.find( "Allocator" ) != std::string::npos )
+		{
+			size_t begin = returnType.find( '<' ) + 1;
+			assert( begin < returnType.find( ',' ) );
+			valueType = returnType.substr( begin, returnType.find( ',' ) - begin );
+		}
+
+		// handle commands go through a dispatcher, VK_CPP_DEFAULT_DISPATCH by default
+		std::string dispatchParameter = commandData.handleCommand ? "typename Dispatch = VK_CPP_DEFAULT_DISPATCH" : "";
+
+		ofs << _indent;
+		if( target == TwoStepTarget::BUFFER )
+		{
+			if( !dispatchParameter.empty() )
+				ofs << "template <" << dispatchParameter << ">\n" << _indent;
+			else
+				ofs << "inline ";
+		}
+		else if( templateIndex != ~0 && ( templateIndex != returnIndex || returnType == "Result" ) )
+		{
+			assert( returnType.find( "Allocator" ) == std::string::npos );
+			ofs << "template <typename T" << ( dispatchParameter.empty() ? "" : ", " + dispatchParameter ) << ">\n" << _indent;
+		}
+		else if( returnType.find( "Allocator" ) != std::string::npos )
+		{
+			ofs << "template <typename Allocator = ";
+			if( inlineCapacity )
+				ofs << "InlineCapacity<" << inlineCapacity << ">";
+			else
+				ofs << "std::allocator<" << valueType << ">";
+
+			ofs << ( dispatchParameter.empty() ? ">" : ", " + dispatchParameter + ">" ) << "\n"
+				<< _indent;
+
+			if( returnType != commandData.returnType && commandData.returnType != "void" && target == TwoStepTarget::NEW_VECTOR )
+				ofs << "typename ";
+		}
+		else if( !dispatchParameter.empty() )
+			ofs << "template <" << dispatchParameter << ">\n" << _indent;
+		else
+			ofs << "inline ";
+
+		if( target == TwoStepTarget::REUSED_VECTOR )
+			ofs << ( commandData.returnType == "Result" ? "ResultValueType<void>::type " : "void " );
+		else if( target == TwoStepTarget::BUFFER )
+			ofs << commandData.returnType << " ";
+		else if( returnType != commandData.returnType && commandData.returnType != "void" )
+		{
+			assert( commandData.returnType == "Result" );
+			ofs << "ResultValueType<" << returnType << ">::type ";
+		}
+		else if( returnIndex != ~0 && 1 < commandData.successCodes.size() )
+		{
+			assert( commandData.returnType == "Result" );
+			ofs << "ResultValue<" << commandData.arguments[ returnIndex ].pureType << "> ";
+		}
+		else
+			ofs << returnType << " ";
+
+		ofs << _reduceName( name ) << "(";
+		bool argEncountered = false;
+		if( skippedArguments.size() + ( commandData.handleCommand ? 1 : 0 ) < commandData.arguments.size() )
+		{
+			size_t lastArgument = ~0;
+			for( size_t i = commandData.arguments.size() - 1; i < commandData.arguments.size(); i-- )
+			{
+				if( skippedArguments.find( i ) == skippedArguments.end() )
+				{
+					lastArgument = i;
+					break;
+				}
+			}
+
+			ofs << " ";
+			for( size_t i = commandData.handleCommand ? 1 : 0; i < commandData.arguments.size(); i++ )
+			{
+				if( skippedArguments.find( i ) == skippedArguments.end() )
+				{
+					if( argEncountered )
+						ofs << ", ";
+
+					auto it = vectorParameters.find( i );
+					size_t pos = commandData.arguments[ i ].type.find( '*' );
+					if( i == returnIndex && target == TwoStepTarget::REUSED_VECTOR )
+						ofs << returnType << "& " << _reduceName( commandData.arguments[ i ].name );
+					else if( i == returnIndex && target == TwoStepTarget::BUFFER )
+						ofs << "ArrayProxy<" << valueType << "> " << _reduceName( commandData.arguments[ i ].name ) << " = nullptr";
+					else if( i == countIndex )
+					{
+						assert( target == TwoStepTarget::BUFFER );
+						ofs << commandData.arguments[ i ].pureType << "& " << _reduceName( commandData.arguments[ i ].name );
+					}
+					else if( it == vectorParameters.end() )
+					{
+						if( pos == std::string::npos )
+						{
+							ofs << commandData.arguments[ i ].type << " " << _reduceName( commandData.arguments[ i ].name );
+							if( !commandData.arguments[ i ].arraySize.empty() )
+								ofs << "[ " << commandData.arguments[ i ].arraySize << " ]";
+
+							if( lastArgument == i )
+							{
+								auto flagIt = vkData->flags.find( commandData.arguments[ i ].pureType );
+								if( flagIt != vkData->flags.end() )
+								{
+									auto depIt = vkData->findDependency( flagIt->first );
+									assert( depIt != vkData->dependencies.end() );
+									assert( depIt->dependencies.size() == 1 );
+									auto enumIt = vkData->enums.find( depIt->dependencies.front() );
+									assert( enumIt != vkData->enums.end() );
+									if( enumIt->second.members.empty() )
+										ofs << " = " << commandData.arguments[ i ].pureType << "()";
+								}
+							}
+						}
+						else
+						{
+							assert( commandData.arguments[ i ].type[ pos ] == '*' );
+							auto n = _reduceName( commandData.arguments[ i ].name );
+
+							if( commandData.arguments[ i ].optional )
+							{
+								ofs << "Optional<"
+									<< StringsHelper::trimEnd( commandData.arguments[ i ].type.substr( 0, pos ) )
+									<< "> " << n << ( target == TwoStepTarget::NEW_VECTOR ? " = nullptr" : "" );
+							}
+							else if( commandData.arguments[ i ].type.find( "char" ) == std::string::npos )
+							{
+								ofs << StringsHelper::trimEnd( commandData.arguments[ i ].type.substr( 0, pos ) )
+									<< "& " << n;
+							}
+							else
+								ofs << "const std::string& " << n;
+						}
+					}
+					else
+					{
+						bool optional = commandData.arguments[ i ].optional && ( it == vectorParameters.end() || it->second == ~0 );
+						assert( pos != std::string::npos );
+						assert( commandData.arguments[ i ].type[ pos ] == '*' );
+						auto n = _reduceName( commandData.arguments[ i ].name );
+						if( commandData.arguments[ i ].type.find( "char" ) != std::string::npos )
+						{
+							if( optional )
+								ofs << "Optional<const std::string> " << n << ( target == TwoStepTarget::NEW_VECTOR ? " = nullptr" : "" );
+							else
+								ofs << "const std::string& " << n;
+						}
+						else
+						{
+							assert( !optional );
+							bool isConst = ( commandData.arguments[ i ].type.find( "const" ) != std::string::npos );
+							ofs << "ArrayProxy<" << ( templateIndex == i ? ( isConst ? "const T" : "T" ) : StringsHelper::trimEnd( commandData.arguments[ i ].type.substr( 0, pos ) ) ) << "> " << n;
+						}
+					}
+					argEncountered = true;
+				}
+			}
+		}
+		if( !dispatchParameter.empty() )
+			ofs << ( argEncountered ? ", " : " " ) << "Dispatch const& d = DefaultDispatch<Dispatch>::dispatch";
+
+		if( argEncountered || !dispatchParameter.empty() )
+			ofs << " ";
+
+		ofs << ")";
+		if( commandData.handleCommand )
+			ofs << " const";
+
+		ofs << std::endl;
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeFunctionBody( std::ostream& ofs,
+										   std::string const& className,
+										   std::string const& functionName,
+										   std::string const& returnType,
+										   size_t templateIndex,
+										   DependencyData const& dependencyData,
+										   CommandData const& commandData,
+										   std::set<std::string> const& vkTypes,
+										   size_t returnIndex,
+										   std::map<size_t, size_t> const& vectorParameters,
+										   TwoStepTarget target ) const
+	{
+		ofs << _indent << "{\n";
+
+		// add a static_assert if a type is templated and its size needs to be some multiple of the original size
+		if( templateIndex != ~0 && commandData.arguments[ templateIndex ].pureType != "void" )
+		{
+			ofs << _indent << "  static_assert( sizeof( T ) % sizeof( "
+				<< commandData.arguments[ templateIndex ].pureType
+				<< " ) == 0, \"wrong size of template type T\" );\n";
+		}
+
+		// add some error checks if multiple vectors need to have the same size
+		if( 1 < vectorParameters.size() )
+		{
+			for( auto it0 = vectorParameters.begin(); it0 != vectorParameters.end(); ++it0 )
+			{
+				if( it0->first == returnIndex )
+					continue;
+
+				for( auto it1 = std::next( it0 ); it1 != vectorParameters.end(); ++it1 )
+				{
+					if( it1->first == returnIndex || it0->second != it1->second )
+						continue;
+
+					auto n0 = _reduceName( commandData.arguments[ it0->first ].name );
+					auto n1 = _reduceName( commandData.arguments[ it1->first ].name );
+
+					ofs << "#ifdef VK_CPP_NO_EXCEPTIONS\n"
+						<< _indent << "  assert( " << n0 << ".size() == " << n1 << ".size() );\n"
+						<< "#else\n"
+						<< _indent << "  if ( " << n0 << ".size() != " << n1 << ".size() )\n"
+						<< _indent << "  {\n"
+						<< _indent << "    throw std::logic_error( \"vk::"
+						<< className << "::" << functionName << ": " << n0 << ".size() != " << n1 << ".size()\" );\n"
+						<< _indent << "  }\n"
+						<< "#endif  // VK_CPP_NO_EXCEPTIONS\n";
+				}
+			}
+		}
+
+		// a single call, the size of the buffer tells how many values fit in
+		if( target == TwoStepTarget::BUFFER )
+		{
+			MemberData const& count = commandData.arguments[ vectorParameters.find( returnIndex )->second ];
+			ofs << _indent << "  " << _reduceName( count.name ) << " = static_cast<" << count.pureType << ">( "
+				<< _reduceName( commandData.arguments[ returnIndex ].name ) << ".size() );\n"
+				<< _indent << "  ";
+
+			if( commandData.returnType == "Result" )
+				ofs << "Result result = static_cast<Result>( ";
+
+			_writeCall( ofs, dependencyData.name, templateIndex, commandData, vkTypes, vectorParameters, returnIndex, false );
+			if( commandData.returnType == "Result" )
+			{
+				ofs << " );\n"
+					<< _indent << "  return createResultValue( result, \"vk::" << ( className.empty() ? "" : className + "::" ) << functionName
+					<< "\", { Result::" << commandData.successCodes[ 0 ];
+				for( size_t i = 1; i < commandData.successCodes.size(); i++ )
+					ofs << ", Result::" << commandData.successCodes[ i ];
+
+				ofs << " } )";
+			}
+			ofs << ";\n" << _indent << "}\n";
+			return;
+		}
+
+		// write the local variable to hold a returned value
+		if( returnIndex != ~0 && target == TwoStepTarget::NEW_VECTOR )
+		{
+			if( commandData.returnType != returnType )
+			{
+				ofs << _indent << "  " << returnType << " "
+					<< _reduceName( commandData.arguments[ returnIndex ].name );
+
+				auto it = vectorParameters.find( returnIndex );
+				if( it != vectorParameters.end() && !commandData.twoStep )
+				{
+					std::string size;
+					if( it->second == ~0 && !commandData.arguments[ returnIndex ].len.empty() )
+					{
+						size = _reduceName( commandData.arguments[ returnIndex ].len );
+						size_t pos = size.find( "->" );
+						assert( pos != std::string::npos );
+						size.replace( pos, 2, "." );
+					}
+					else
+					{
+						for( auto& sit : vectorParameters )
+						{
+							if( sit.first != returnIndex && sit.second == it->second )
+							{
+								size = _reduceName( commandData.arguments[ sit.first ].name ) + ".size()";
+								break;
+							}
+						}
+					}
+					assert( !size.empty() );
+					ofs << "( " << size << " )";
+				}
+				ofs << ";\n";
+			}
+			else if( 1 < commandData.successCodes.size() )
+			{
+				ofs << _indent << "  "
+					<< commandData.arguments[ returnIndex ].pureType
+					<< " " << _reduceName( commandData.arguments[ returnIndex ].name )
+					<< ";\n";
+			}
+		}
+
+		// a reused vector keeps its capacity, but none of its values
+		if( target == TwoStepTarget::REUSED_VECTOR )
+			ofs << _indent << "  " << _reduceName( commandData.arguments[ returnIndex ].name ) << ".clear();\n";
+
+		// local count variable to hold the size of the vector to fill
+		if( commandData.twoStep )
+		{
+			assert( returnIndex != ~0 );
+
+			auto returnit = vectorParameters.find( returnIndex );
+			assert( returnit != vectorParameters.end() && returnit->second != ~0 );
+			assert( commandData.returnType == "Result" || commandData.returnType == "void" );
+
+			ofs << _indent << "  "
+				<< commandData.arguments[ returnit->second ].pureType << " "
+				<< _reduceName( commandData.arguments[ returnit->second ].name )
+					<< ";\n";
+		}
+
+		// write the function call
+		ofs << _indent << "  ";
+		std::string localIndentation = "  ";
+		if( commandData.returnType == "Result" )
+		{
+			ofs << "Result result";
+			if( commandData.twoStep && ( 1 < commandData.successCodes.size() ) )
+			{
+				ofs << ";\n"
+					<< _indent << "  do\n"
+					<< _indent << "  {\n"
+					<< _indent << "    result";
+				localIndentation += "  ";
+			}
+			ofs << " = static_cast<Result>( ";
+		}
+		else if( commandData.returnType != "void" )
+		{
+			assert( !commandData.twoStep );
+			ofs << "return ";
+		}
+		_writeCall( ofs, dependencyData.name, templateIndex, commandData, vkTypes, vectorParameters, returnIndex, true );
+		if( commandData.returnType == "Result" )
+			ofs << " )";
+
+		ofs << ";\n";
+
+		if( commandData.twoStep )
+		{
+			auto returnit = vectorParameters.find( returnIndex );
+
+			if( commandData.returnType == "Result" )
+			{
+				ofs << _indent << localIndentation << "if( result == Result::eSuccess && "
+					<< _reduceName( commandData.arguments[ returnit->second ].name ) << " )\n"
+					<< _indent << localIndentation << "{\n"
+					<< _indent << localIndentation << "  ";
+			}
+			else
+				ofs << _indent << "  ";
+
+			// resize the vector to hold the data according to the result from the first call
+			ofs << _reduceName( commandData.arguments[ returnit->first ].name )
+					<< ".resize( " << _reduceName( commandData.arguments[ returnit->second ].name ) << " );\n";
+
+			// write the function call a second time
+			if( commandData.returnType == "Result" )
+				ofs << _indent << localIndentation << "  result = static_cast<Result>( ";
+
+			else
+				ofs << _indent << "  ";
+
+			_writeCall( ofs, dependencyData.name, templateIndex, commandData, vkTypes, vectorParameters, returnIndex, false );
+			if( commandData.returnType == "Result" )
+				ofs << " )";
+
+			ofs << ";\n";
+			if( commandData.returnType == "Result" )
+			{
+				ofs << _indent << localIndentation << "}\n";
+				if( 1 < commandData.successCodes.size() )
+					ofs << _indent << "  } while( result == Result::eIncomplete );\n";
+			}
+		}
+
+		if( commandData.returnType == "Result" || !commandData.successCodes.empty() )
+		{
+			ofs << _indent << "  return createResultValue( result, ";
+			if( returnIndex != ~0 && target == TwoStepTarget::NEW_VECTOR )
+				ofs << _reduceName( commandData.arguments[ returnIndex ].name ) << ", ";
+
+			ofs << "\"vk::" << ( className.empty() ? "" : className + "::" ) << functionName << "\"";
+			if( 1 < commandData.successCodes.size() && !commandData.twoStep )
+			{
+				ofs << ", { Result::" << commandData.successCodes[ 0 ];
+				for( size_t i = 1; i < commandData.successCodes.size(); i++ )
+					ofs << ", Result::" << commandData.successCodes[ i ];
+
+				ofs << " }";
+			}
+			ofs << " );\n";
+		}
+		else if( returnIndex != ~0 && commandData.returnType != returnType && target == TwoStepTarget::NEW_VECTOR )
+			ofs << _indent << "  return " << _reduceName( commandData.arguments[ returnIndex ].name ) << ";\n";
+
+		ofs << _indent << "}\n";
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeCall( std::ostream& ofs, std::string const& name,
+								   size_t templateIndex,
+								   CommandData const& commandData,
+								   std::set<std::string> const& vkTypes,
+								   std::map<size_t, size_t> const& vectorParameters,
+								   size_t returnIndex, bool firstCall ) const
+	{
+		std::map<size_t, size_t> countIndices;
+		for( auto& it : vectorParameters )
+			countIndices.insert( std::make_pair( it.second, it.first ) );
+
+		if( vectorParameters.size() == 1
+			&& ( commandData.arguments[ vectorParameters.begin()->first ].len == "dataSize/4"
+				 || commandData.arguments[ vectorParameters.begin()->first ].len == "latexmath:[$dataSize \\over 4$]" ) )
+		{
+			assert( commandData.arguments[ 3 ].name == "dataSize" );
+			countIndices.insert( std::make_pair( 3, vectorParameters.begin()->first ) );
+		}
+
+		assert( islower( name[ 0 ] ) );
+		if( commandData.handleCommand )
+			ofs << "d.";
+
+		ofs << "vk" << static_cast<char>( toupper( name[ 0 ] ) ) << name.substr( 1 ) << "( ";
+		size_t i = 0;
+		if( commandData.handleCommand )
+		{
+			ofs << "m_" << commandData.arguments[ 0 ].name;
+			i++;
+		}
+		for( ; i < commandData.arguments.size(); i++ )
+		{
+			if( 0 < i )
+				ofs << ", ";
+
+			std::map<size_t, size_t>::const_iterator it = countIndices.find( i );
+			if( it != countIndices.end() )
+			{
+				if( returnIndex == it->second && commandData.twoStep )
+					ofs << "&" << _reduceName( commandData.arguments[ it->first ].name );
+
+				else
+				{
+					ofs << _reduceName( commandData.arguments[ it->second ].name ) << ".size() ";
+					if( templateIndex == it->second )
+						ofs << "* sizeof( T ) ";
+				}
+			}
+			else
+			{
+				it = vectorParameters.find( i );
+				if( it != vectorParameters.end() )
+				{
+					assert( commandData.arguments[ it->first ].type.back() == '*' );
+					if( returnIndex == it->first && commandData.twoStep && firstCall )
+						ofs << "nullptr";
+
+					else
+					{
+						auto vkit = vkTypes.find( commandData.arguments[ it->first ].pureType );
+						if( vkit != vkTypes.end() || it->first == templateIndex )
+						{
+							ofs << "reinterpret_cast<";
+							if( commandData.arguments[ it->first ].type.find( "const" ) != std::string::npos )
+								ofs << "const ";
+
+							if( vkit != vkTypes.end() )
+								ofs << "Vk";
+
+							ofs << commandData.arguments[ it->first ].pureType
+								<< "*>( " << _reduceName( commandData.arguments[ it->first ].name ) << ".data() )";
+						}
+						else if( commandData.arguments[ it->first ].pureType == "char" )
+						{
+							ofs << _reduceName( commandData.arguments[ it->first ].name );
+							if( commandData.arguments[ it->first ].optional )
+								ofs << " ? " << _reduceName( commandData.arguments[ it->first ].name ) << "->c_str() : nullptr";
+
+							else
+								ofs << ".c_str()";
+						}
+						else
+							ofs << _reduceName( commandData.arguments[ it->first ].name ) << ".data()";
+					}
+				}
+				else if( vkTypes.find( commandData.arguments[ i ].pureType ) != vkTypes.end() )
+				{
+					if( commandData.arguments[ i ].type.back() == '*' )
+					{
+						if( commandData.arguments[ i ].type.find( "const" ) != std::string::npos )
+						{
+							ofs << "reinterpret_cast<const Vk" << commandData.arguments[ i ].pureType << "*>( ";
+							if( commandData.arguments[ i ].optional )
+								ofs << "static_cast<const " << commandData.arguments[ i ].pureType << "*>( ";
+							else
+								ofs << "&";
+
+							ofs << _reduceName( commandData.arguments[ i ].name ) << ( commandData.arguments[ i ].optional ? ") )" : " )" );
+						}
+						else
+						{
+							assert( !commandData.arguments[ i ].optional );
+							ofs << "reinterpret_cast<Vk" << commandData.arguments[ i ].pureType << "*>( &" << _reduceName( commandData.arguments[ i ].name ) << " )";
+						}
+					}
+					else
+						ofs << "static_cast<Vk" << commandData.arguments[ i ].pureType << ">( " << commandData.arguments[ i ].name << " )";
+				}
+				else
+				{
+					if( commandData.arguments[ i ].type.back() == '*' )
+					{
+						if( commandData.arguments[ i ].type.find( "const" ) != std::string::npos )
+						{
+							assert( commandData.arguments[ i ].type.find( "char" ) != std::string::npos );
+							ofs << _reduceName( commandData.arguments[ i ].name );
+							if( commandData.arguments[ i ].optional )
+								ofs << " ? " << _reduceName( commandData.arguments[ i ].name ) << "->c_str() : nullptr";
+							else
+								ofs << ".c_str()";
+						}
+						else
+						{
+							assert( commandData.arguments[ i ].type.find( "char" ) == std::string::npos );
+							ofs << "&" << _reduceName( commandData.arguments[ i ].name );
+						}
+					}
+					else
+						ofs << commandData.arguments[ i ].name;
+				}
+			}
+		}
+		ofs << " )";
+	}
+	//--------------------------------------------------------------------------
+	void CppGenerator::_writeComment( std::ostream& ofs, std::string const& name,
+						std::string const& type ) const
+	{
+		ofs << _indent << "/**\n"
+			<< _indent << " * @brief The " << name
+			<< " " << type << ".\n"
+			<< _indent << " */\n";
+	}
+
+
+	//Unreferenced method
+	/*void CppGenerator::_writeExceptionCheck( std::ostream& ofs,
+											 std::string const& indentation,
+											 std::string const& className,
+											 std::string const& functionName,
+											 std::vector<std::string> const& successCodes )
+	{
+		assert( !successCodes.empty() );
+		ofs << indentation << "  if (";
+		if( successCodes.size() == 1 )
+		{
+			assert( successCodes.front() == "eSuccess" );
+			ofs << " result != Result::eSuccess";
+		}
+		else
+		{
+			for( size_t i = 0; i < successCodes.size() - 1; i++ )
+				ofs << " ( result != Result::" << successCodes[ i ] << " ) &&";
+
+			ofs << " ( result != Result::" << successCodes.back() << " )";
+		}
+		ofs << " )" << std::endl;
+		ofs << indentation << "  {" << std::endl
+			<< indentation << "    throw std::system_error( result, \"vk::";
+		if( !className.empty() )
+			ofs << className << "::";
+
+		ofs << functionName << "\" );" << std::endl
+			<< indentation << "  }" << std::endl;
+	}*/
+} // end of vk namespace
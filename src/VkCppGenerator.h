@@ -28,6 +28,7 @@
 
 #include "VkSpecParser.h"
 #include "VkTextIndent.h"
+#include <functional>
 
 namespace vk
 {
@@ -50,20 +51,46 @@ namespace vk
 			std::string cmdLine;
 			char indentChar;
 			unsigned short spaceSize = 1;
+			bool mappedInput = false;
+			unsigned threads = 1;
+			bool writeIfChanged = false;
+			bool stringTables = false;
+			bool constexprTypes = false;
+			bool statefulCommandBuffer = false;
 		};
 
 		int generate( const Options& opt );
 
 	private:
 		TextIndent _indent;
+		unsigned _threads = 1;
+		bool _stringTables = false;
+		bool _constexprTypes = false;
+		bool _statefulCommandBuffer = false;
+
+		typedef std::function<void( CppGenerator& writer, DualOFStream& ofs,
+									DependencyData const& dependencyData )> DependencyWriter;
+
+		/**
+		 * @brief where the enhanced version of a two-step command puts the
+		 * enumerated values: a new vector (the default), a vector passed by the
+		 * caller, reused without shrinking, or a caller provided buffer, which
+		 * is filled in a single call and may leave the count alone.
+		 */
+		enum class TwoStepTarget
+		{
+			NEW_VECTOR,
+			REUSED_VECTOR,
+			BUFFER
+		};
 
 		void _enterProtect( DualOFStream& ofs, std::string const& protect ) const;
 
 		void _leaveProtect( DualOFStream& ofs, std::string const& protect ) const;
 
-		void _enterProtect( std::ofstream& ofs, std::string const& protect ) const;
+		void _enterProtect( std::ostream& ofs, std::string const& protect ) const;
 
-		void _leaveProtect( std::ofstream& ofs, std::string const& protect ) const;
+		void _leaveProtect( std::ostream& ofs, std::string const& protect ) const;
 
 		std::string _determineFunctionName( std::string const& name,
 											CommandData const& commandData ) const;
@@ -71,6 +98,19 @@ namespace vk
 		std::string _determineReturnType( CommandData const& commandData,
 										  size_t returnIndex, bool isVector = false ) const;
 
+		/**
+		 * @brief get the inline capacity of the SmallVector the enhanced
+		 * version of a two-step command returns, or 0 for a std::vector.
+		 */
+		size_t _determineInlineCapacity( std::string const& name ) const;
+
+		/**
+		 * @brief get the values of the members of an enum, with the index of
+		 * each member, sorted by value. Returns false if a value isn't a number.
+		 */
+		bool _getEnumValues( EnumData const& enumData,
+							 std::vector<std::pair<int64_t, size_t>>& values ) const;
+
 		std::string _reduceName( std::string const& name ) const;
 
 		size_t _findReturnIndex( CommandData const& commandData,
@@ -86,19 +126,105 @@ namespace vk
 		bool _isVectorSizeParameter( std::map<size_t, size_t> const& vectorParameters,
 									 size_t idx ) const;
 
-		void _sortDependencies( std::list<DependencyData>& dependencies ) const;
-
-		bool _noDependencies( std::set<std::string> const& dependencies,
-							  std::set<std::string>& listedTypes ) const;
+		void _sortDependencies( DependencyList& dependencies,
+								SymbolTable& symbols ) const;
 
 		void _createDefaults( SpecData* vkData,
 							  std::map<std::string, std::string>& defaultValues ) const;
 
 		//Write methods
 		//----------------------------------------------------------------------
-		void _writeVersionCheck( std::ofstream& ofs, std::string const& version ) const;
-
-		void _writeTypesafeCheck( std::ofstream& ofs, std::string const& typesafeCheck ) const;
+		void _writeVersionCheck( std::ostream& ofs, std::string const& version ) const;
+
+		void _writeTypesafeCheck( std::ostream& ofs, std::string const& typesafeCheck ) const;
+
+		/**
+		 * @brief write GlobalDispatch, which forwards each handle command to
+		 * the loader, and the InstanceDispatch and DeviceDispatch function
+		 * pointer tables. The handle methods take any of them as last argument,
+		 * VK_CPP_DEFAULT_DISPATCH selects the one used when it's omitted.
+		 */
+		void _writeDispatchTables( std::ostream& ofs, SpecData* vkData );
+
+		void _writeDispatchTable( std::ostream& ofs, std::string const& name, std::string const& level,
+								  std::vector<SymbolMap<CommandData>::const_iterator> const& commands );
+
+		/**
+		 * @brief write CommandStream, the CommandRecorder dispatcher which
+		 * records the vkCmd commands into one, and replay, which calls them
+		 * back on a command buffer.
+		 */
+		void _writeCommandStream( std::ostream& ofs, SpecData* vkData );
+
+		/**
+		 * @brief write UniqueHandle, a deleter for each parent or pool of the
+		 * handles which are destroyed or freed, and the UniqueXXX typedefs.
+		 */
+		void _writeUniqueHandles( std::ostream& ofs, SpecData* vkData );
+
+		/**
+		 * @brief the index of the argument of a destroy or free command holding
+		 * the handle destroyed.
+		 */
+		size_t _getDestroyedIndex( CommandData const& commandData ) const;
+
+		/**
+		 * @brief whether an argument of a destroy or free command is held by
+		 * its deleter, as the parent, the pool or the allocator are.
+		 */
+		bool _isDeleterState( CommandData const& commandData, size_t index ) const;
+
+		std::string _getDeleterName( CommandData const& commandData ) const;
+
+		std::string _getDeleterMember( MemberData const& argument ) const;
+
+		/**
+		 * @brief write StatefulCommandBuffer, the dispatcher which keeps a
+		 * shadow of the state bound on a command buffer and drops the bind and
+		 * set commands repeating it.
+		 */
+		void _writeStatefulCommandBuffer( std::ostream& ofs, SpecData* vkData );
+
+		void _writeStatefulCommand( std::ostream& ofs, SpecData* vkData,
+									SymbolMap<CommandData>::const_iterator it, size_t index,
+									std::vector<SymbolMap<CommandData>::const_iterator> const& tracked );
+
+		/**
+		 * @brief the C arguments of a command, as the dispatchers take them.
+		 */
+		void _writeDispatchArguments( std::ostream& ofs, SpecData* vkData, CommandData const& commandData );
+
+		std::string _getStateName( std::string const& commandName ) const;
+
+		std::string _getStateMember( std::string const& commandName ) const;
+
+		/**
+		 * @brief the argument a command keeps separate state for, its pipeline
+		 * bind point, or nullptr.
+		 */
+		MemberData const* _getStateKey( CommandData const& commandData ) const;
+
+		/**
+		 * @brief the pointer members of the struct an argument points to,
+		 * whose arrays are recorded along with it.
+		 */
+		std::vector<MemberData const*> _getCopiedMembers( SpecData* vkData, MemberData const& argument ) const;
+
+		/**
+		 * @brief the C++ expression of an argument's len attribute.
+		 */
+		std::string _getLenExpression( MemberData const& argument ) const;
+
+		void _writeRecordArgument( std::ostream& ofs, SpecData* vkData, MemberData const& argument );
+
+		void _writeReplayArgument( std::ostream& ofs, SpecData* vkData, MemberData const& argument );
+
+		/**
+		 * @brief the C type of a C++ type, whose vk types and scalars (pureType,
+		 * or the whole type if it's empty) get their Vk prefix back.
+		 */
+		std::string _getCType( std::string const& type, SpecData* vkData,
+							   std::string const& pureType = "" ) const;
 
 		void _writeEnumsToString( DualOFStream& ofs, SpecData* vkData );
 
@@ -106,6 +232,32 @@ namespace vk
 								  DependencyData const& dependencyData,
 								  EnumData const& enumData );
 
+		/**
+		 * @brief write from_string for an enum, a binary search in the names
+		 * of its members, with or without their leading 'e'.
+		 */
+		void _writeEnumFromString( DualOFStream& ofs,
+								   DependencyData const& dependencyData,
+								   EnumData const& enumData );
+
+		/**
+		 * @brief write the table driven body of to_cstring for an enum, given
+		 * the values of its members sorted by _getEnumValues.
+		 */
+		void _writeEnumTable( DualOFStream& ofs,
+							  DependencyData const& dependencyData,
+							  EnumData const& enumData,
+							  std::vector<std::pair<int64_t, size_t>> const& values );
+
+		/**
+		 * @brief write bit_name, the name of a single bit of a bitmask enum
+		 * or nullptr, which the to_string of its flags looks up per bit set.
+		 */
+		void _writeBitNames( DualOFStream& ofs,
+							 DependencyData const& dependencyData,
+							 EnumData const& enumData,
+							 std::vector<std::pair<int64_t, size_t>> const& values );
+
 		void _writeFlagsToString( DualOFStream& ofs,
 								  DependencyData const& dependencyData,
 								  EnumData const& enumData );
@@ -115,22 +267,30 @@ namespace vk
 		void _writeTypes( DualOFStream& ofs, SpecData* vkData,
 						  std::map<std::string, std::string> const& defaultValues );
 
-		void _writeTypeCommand( std::ofstream& ofs, SpecData* vkData,
+		/**
+		 * @brief call write for every entry of the sorted dependency list.
+		 * With more than one thread, entries are rendered concurrently into
+		 * separate buffers, then written out in order.
+		 */
+		void _writeDependencies( DualOFStream& ofs, SpecData* vkData,
+								 DependencyWriter const& write );
+
+		void _writeTypeCommand( std::ostream& ofs, SpecData* vkData,
 								DependencyData const& dependencyData ) const;
 
-		void _writeTypeCommandStandard( std::ofstream& ofs,
+		void _writeTypeCommandStandard( std::ostream& ofs,
 										std::string const& functionName,
 										DependencyData const& dependencyData,
 										CommandData const& commandData,
 										std::set<std::string> const& vkTypes ) const;
 
-		void _writeTypeCommandEnhanced( std::ofstream& ofs, SpecData* vkData,
+		void _writeTypeCommandEnhanced( std::ostream& ofs, SpecData* vkData,
 										std::string const& className,
 										std::string const& functionName,
 										DependencyData const& dependencyData,
 										CommandData const& commandData ) const;
 
-		void _writeTypeEnum( std::ofstream& ofs,
+		void _writeTypeEnum( std::ostream& ofs,
 							 DependencyData const& dependencyData,
 							 EnumData const& enumData );
 
@@ -140,10 +300,9 @@ namespace vk
 
 		void _writeTypeHandle( DualOFStream& ofs, SpecData* vkData,
 							   DependencyData const& dependencyData,
-							   HandleData const& handle,
-							   std::list<DependencyData> const& dependencies );
+							   HandleData const& handle );
 
-		void _writeTypeScalar( std::ofstream& ofs,
+		void _writeTypeScalar( std::ostream& ofs,
 							   DependencyData const& dependencyData ) const;
 
 		void _writeTypeStruct( DualOFStream& ofs, SpecData* vkData,
@@ -168,22 +327,30 @@ namespace vk
 								 std::set<std::string> const& vkTypes//,
 								 /*std::map<std::string,StructData> const& structs*/ );
 
+		/**
+		 * @brief write the initializer of a member from the constructor
+		 * argument named after it, element by element for an array.
+		 */
+		void _writeMemberInitializer( std::ostream& ofs, MemberData const& memberData ) const;
+
 		//TypeCommandStandard
 		//----------------------------------------------------------------------
-		void _writeMemberData( std::ofstream& ofs, MemberData const& memberData,
+		void _writeMemberData( std::ostream& ofs, MemberData const& memberData,
 							   std::set<std::string> const& vkTypes ) const;
 
 		//TypeCommandEnhanced
 		//----------------------------------------------------------------------
-		void _writeFunctionHeader( std::ofstream& ofs, SpecData* vkData,
+		void _writeFunctionHeader( std::ostream& ofs, SpecData* vkData,
 								   std::string const& returnType,
 								   std::string const& name,
 								   CommandData const& commandData,
 								   size_t returnIndex,
 								   size_t templateIndex,
-								   std::map<size_t, size_t> const& vectorParameters ) const;
+								   std::map<size_t, size_t> const& vectorParameters,
+								   TwoStepTarget target = TwoStepTarget::NEW_VECTOR,
+								   size_t inlineCapacity = 0 ) const;
 
-		void _writeFunctionBody( std::ofstream& ofs,
+		void _writeFunctionBody( std::ostream& ofs,
 								 std::string const& className,
 								 std::string const& functionName,
 								 std::string const& returnType,
@@ -192,20 +359,21 @@ namespace vk
 								 CommandData const& commandData,
 								 std::set<std::string> const& vkTypes,
 								 size_t returnIndex,
-								 std::map<size_t, size_t> const& vectorParameters ) const;
+								 std::map<size_t, size_t> const& vectorParameters,
+								 TwoStepTarget target = TwoStepTarget::NEW_VECTOR ) const;
 
-		void _writeCall( std::ofstream& ofs, std::string const& name,
+		void _writeCall( std::ostream& ofs, std::string const& name,
 						 size_t templateIndex,
 						 CommandData const& commandData,
 						 std::set<std::string> const& vkTypes,
 						 std::map<size_t, size_t> const& vectorParameters,
 						 size_t returnIndex, bool firstCall ) const;
 
-		void _writeComment( std::ofstream& ofs, std::string const& name,
+		void _writeComment( std::ostream& ofs, std::string const& name,
 							std::string const& type ) const;
 
 		//Unreferenced method
-		/*void _writeExceptionCheck( std::ofstream& ofs,
+		/*void _writeExceptionCheck( std::ostream& ofs,
 								   std::string const& indentation,
 								   std::string const& className,
 								   std::string const& functionName,
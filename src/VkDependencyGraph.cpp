@@ -0,0 +1,166 @@
+// Copyright(c) 2015-2016, NVIDIA CORPORATION. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "VkDependencyGraph.h"
+#include <cassert>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+
+namespace vk
+{
+	DependencyGraph::DependencyGraph( DependencyList const& dependencies,
+									  SymbolTable& symbols,
+									  std::set<std::string> const& predefined )
+		: _symbols( symbols )
+	{
+		for( auto& it : predefined )
+			symbols.intern( it );
+
+		_definedBy.assign( symbols.size(), ~size_t( 0 ) );
+		_predefined.assign( symbols.size(), false );
+		for( auto& it : predefined )
+			_predefined[ symbols.find( it ) ] = true;
+
+		_nodeSymbol.reserve( dependencies.size() );
+		_nodeDependenciesOffset.reserve( dependencies.size() + 1 );
+		_nodeDependenciesOffset.push_back( 0 );
+
+		for( auto& it : dependencies )
+		{
+			if( _definedBy[ it.symbol ] == ~size_t( 0 ) )
+				_definedBy[ it.symbol ] = _nodeSymbol.size();
+
+			_nodeSymbol.push_back( it.symbol );
+
+			// DependencyData::dependencies is a set, so each symbol is listed once per node
+			for( auto dependency : it.dependencies )
+			{
+				if( !_predefined[ dependency ] )
+					_nodeDependencies.push_back( dependency );
+			}
+			_nodeDependenciesOffset.push_back( _nodeDependencies.size() );
+		}
+
+		// invert the node -> symbol edges into a compact symbol -> dependent nodes table
+		_dependentsOffset.assign( _symbols.size() + 1, 0 );
+		for( auto symbol : _nodeDependencies )
+			_dependentsOffset[ symbol + 1 ]++;
+
+		for( size_t i = 1; i < _dependentsOffset.size(); i++ )
+			_dependentsOffset[ i ] += _dependentsOffset[ i - 1 ];
+
+		std::vector<size_t> fill( _dependentsOffset.begin(), _dependentsOffset.end() - 1 );
+		_dependents.resize( _nodeDependencies.size() );
+		for( size_t node = 0; node < _nodeSymbol.size(); node++ )
+		{
+			for( size_t i = _nodeDependenciesOffset[ node ]; i < _nodeDependenciesOffset[ node + 1 ]; i++ )
+				_dependents[ fill[ _nodeDependencies[ i ] ]++ ] = node;
+		}
+	}
+	//--------------------------------------------------------------------------
+	std::vector<size_t> DependencyGraph::sort() const
+	{
+		std::vector<bool> listed( _predefined );
+		std::vector<size_t> inDegree( _nodeSymbol.size() );
+		std::priority_queue<size_t, std::vector<size_t>, std::greater<size_t>> ready;
+
+		for( size_t node = 0; node < _nodeSymbol.size(); node++ )
+		{
+			inDegree[ node ] = _nodeDependenciesOffset[ node + 1 ] - _nodeDependenciesOffset[ node ];
+			if( !inDegree[ node ] )
+				ready.push( node );
+		}
+
+		std::vector<size_t> order;
+		order.reserve( _nodeSymbol.size() );
+		while( !ready.empty() )
+		{
+			size_t node = ready.top();
+			ready.pop();
+			order.push_back( node );
+
+			SymbolTable::Id symbol = _nodeSymbol[ node ];
+			if( listed[ symbol ] )
+				continue;
+
+			listed[ symbol ] = true;
+			for( size_t i = _dependentsOffset[ symbol ]; i < _dependentsOffset[ symbol + 1 ]; i++ )
+			{
+				assert( 0 < inDegree[ _dependents[ i ] ] );
+				if( !--inDegree[ _dependents[ i ] ] )
+					ready.push( _dependents[ i ] );
+			}
+		}
+
+		if( order.size() != _nodeSymbol.size() )
+			throw std::runtime_error( _describeCycle( listed, inDegree ) );
+
+		return order;
+	}
+	//--------------------------------------------------------------------------
+	std::string DependencyGraph::_describeCycle( std::vector<bool> const& listed,
+												 std::vector<size_t> const& inDegree ) const
+	{
+		// every node left behind has at least one unlisted dependency, so walking
+		// along those dependencies either ends on an undefined type or loops
+		size_t node = 0;
+		while( !inDegree[ node ] )
+			node++;
+
+		std::vector<size_t> path;
+		std::vector<size_t> position( _nodeSymbol.size(), ~size_t( 0 ) );
+		while( position[ node ] == ~size_t( 0 ) )
+		{
+			position[ node ] = path.size();
+			path.push_back( node );
+
+			SymbolTable::Id dependency = SymbolTable::invalid;
+			for( size_t i = _nodeDependenciesOffset[ node ]; i < _nodeDependenciesOffset[ node + 1 ]; i++ )
+			{
+				if( !listed[ _nodeDependencies[ i ] ] )
+				{
+					dependency = _nodeDependencies[ i ];
+					break;
+				}
+			}
+			assert( dependency != SymbolTable::invalid );
+
+			if( _definedBy[ dependency ] == ~size_t( 0 ) )
+			{
+				return "DependencyGraph: type \"" + _symbols.name( dependency )
+					+ "\" required by \"" + _symbols.name( _nodeSymbol[ node ] )
+					+ "\" is never defined";
+			}
+			node = _definedBy[ dependency ];
+		}
+
+		std::string cycle = "DependencyGraph: dependency cycle detected: ";
+		for( size_t i = position[ node ]; i < path.size(); i++ )
+			cycle += _symbols.name( _nodeSymbol[ path[ i ] ] ) + " -> ";
+
+		return cycle + _symbols.name( _nodeSymbol[ node ] );
+	}
+}
@@ -0,0 +1,73 @@
+// Copyright(c) 2015-2016, NVIDIA CORPORATION. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#ifndef VKDEPENDENCYGRAPH_H
+#define VKDEPENDENCYGRAPH_H
+
+#include "VkSpecParser.h"
+
+namespace vk
+{
+	class DependencyGraph
+	{
+	public:
+		/**
+		 * @brief build the graph out of a dependency list, whose names have
+		 * been interned in symbols. Names listed in predefined are considered
+		 * as already resolved.
+		 */
+		DependencyGraph( DependencyList const& dependencies,
+						 SymbolTable& symbols,
+						 std::set<std::string> const& predefined );
+
+		/**
+		 * @brief sort the dependency list given to the constructor.
+		 *
+		 * Among all the entries whose dependencies are resolved, the one which
+		 * comes first in the original list is always picked first.
+		 * Throws a std::runtime_error describing the cycle (or the missing type)
+		 * if the list can't be sorted.
+		 */
+		std::vector<size_t> sort() const;
+
+	private:
+		std::string _describeCycle( std::vector<bool> const& listed,
+									std::vector<size_t> const& inDegree ) const;
+
+		SymbolTable const&							_symbols;
+
+		// per symbol: the first node defining it and the nodes depending on it
+		std::vector<size_t>							_definedBy;
+		std::vector<size_t>							_dependentsOffset;
+		std::vector<size_t>							_dependents;
+		std::vector<bool>							_predefined;
+
+		// per node: its symbol and the unresolved symbols it depends on
+		std::vector<SymbolTable::Id>				_nodeSymbol;
+		std::vector<size_t>							_nodeDependenciesOffset;
+		std::vector<SymbolTable::Id>				_nodeDependencies;
+	};
+}
+#endif // VKDEPENDENCYGRAPH_H
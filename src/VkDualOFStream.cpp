@@ -24,11 +24,13 @@
 // (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "VkDualOFStream.h"
+#include <cassert>
 #include <iostream>
 
 namespace vk
 {
 	DualOFStream::DualOFStream( const CppGenerator::Options& opt )
+		: _writeIfChanged( opt.writeIfChanged )
 	{
 		auto lastDirChar = opt.outHeaderDirectory[ opt.outHeaderDirectory.size() - 1 ];
 		auto hasDirTrailingSlash = lastDirChar == '\\' || lastDirChar == '/';
@@ -39,7 +41,8 @@ namespace vk
 		auto dest = opt.outHeaderDirectory + sep + _hdrFileName;
 
 		std::cout << "Writing to \"" << _hdrFileName << "\"";
-		_hdr = new std::ofstream( dest );
+		_hdrPath = dest;
+		_hdr = new std::ostream( &_hdrBuffer );
 
 		if( !opt.srcExt.empty() )
 		{
@@ -57,7 +60,8 @@ namespace vk
 			dest += sep + _srcFileName;
 
 			std::cout << " and to \"" << _srcFileName << "\"";
-			_src = new std::ofstream( dest );
+			_srcPath = dest;
+			_src = new std::ostream( &_srcBuffer );
 		}
 
 		std::cout << " (" << opt.outHeaderDirectory
@@ -65,6 +69,14 @@ namespace vk
 				  << ")\n";
 	}
 	//--------------------------------------------------------------------------
+	DualOFStream::DualOFStream( bool dual )
+		: _inMemory( true )
+	{
+		_hdr = new std::ostream( &_hdrBuffer );
+		if( dual )
+			_src = new std::ostream( &_srcBuffer );
+	}
+	//--------------------------------------------------------------------------
 	DualOFStream::~DualOFStream()
 	{
 		delete _hdr;
@@ -77,7 +89,7 @@ namespace vk
 		}
 	}
 	//--------------------------------------------------------------------------
-	std::ofstream& DualOFStream::src()
+	std::ostream& DualOFStream::src()
 	{
 		if( _src )
 			return *_src;
@@ -85,6 +97,40 @@ namespace vk
 		return hdr();
 	}
 	//--------------------------------------------------------------------------
+	void DualOFStream::append( DualOFStream& part )
+	{
+		assert( part._inMemory && ( !part._src == !_src ) );
+
+		_hdrBuffer.splice( part._hdrBuffer );
+		if( _src )
+			_srcBuffer.splice( part._srcBuffer );
+	}
+	//--------------------------------------------------------------------------
+	void DualOFStream::appendHeader( DualOFStream& part )
+	{
+		assert( part._inMemory && !part._src );
+
+		_hdrBuffer.splice( part._hdrBuffer );
+	}
+	//--------------------------------------------------------------------------
+	void DualOFStream::close()
+	{
+		assert( !_inMemory );
+
+		_writeFile( _hdrBuffer, _hdrPath, _hdrFileName );
+		if( _src )
+			_writeFile( _srcBuffer, _srcPath, _srcFileName );
+	}
+	//--------------------------------------------------------------------------
+	void DualOFStream::_writeFile( OutputBuffer const& buffer, std::string const& path,
+								   std::string const& fileName ) const
+	{
+		if( _writeIfChanged && buffer.matchesFile( path ) )
+			std::cout << "\"" << fileName << "\" is up to date, left untouched\n";
+		else
+			buffer.writeFile( path );
+	}
+	//--------------------------------------------------------------------------
 	DualOFStream& DualOFStream::operator<<( DualOFStreamManip manip )
 	{
 		return manip( *this );
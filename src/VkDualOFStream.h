@@ -26,7 +26,8 @@
 #ifndef VKDUALOFSTREAM_H
 #define VKDUALOFSTREAM_H
 
-#include <fstream>
+#include <ostream>
+#include "VkOutputBuffer.h"
 #include "VkCppGenerator.h"
 
 namespace vk
@@ -35,10 +36,41 @@ namespace vk
 	{
 	public:
 		DualOFStream( const CppGenerator::Options& opt );
+
+		/**
+		 * @brief in-memory stream pair, for output which is rendered ahead of
+		 * time and appended to the files later on.
+		 */
+		explicit DualOFStream( bool dual );
+
 		~DualOFStream();
 
-		std::ofstream& hdr() { return *_hdr; }
-		std::ofstream& src();
+		DualOFStream( DualOFStream const& ) = delete;
+		DualOFStream& operator=( DualOFStream const& ) = delete;
+
+		std::ostream& hdr() { return *_hdr; }
+		std::ostream& src();
+
+		/**
+		 * @brief move what has been rendered into an in-memory stream pair to
+		 * the end of this one.
+		 */
+		void append( DualOFStream& part );
+
+		/**
+		 * @brief move what has been rendered into an in-memory single stream
+		 * to the end of the header, for definitions which have to be visible
+		 * to the users of the header.
+		 */
+		void appendHeader( DualOFStream& part );
+
+		/**
+		 * @brief write the files. Output is kept in memory until then, and is
+		 * dropped if the stream is destroyed without being closed.
+		 * With Options::writeIfChanged, files which already hold the output
+		 * are left untouched and reported as such.
+		 */
+		void close();
 
 		bool usingDualStream() const { return _src != 0; }
 
@@ -69,11 +101,20 @@ namespace vk
 		DualOFStream& operator<<( StandardEndLine manip );
 
 	private:
-		std::ofstream* _hdr = 0;
-		std::ofstream* _src = 0;
+		OutputBuffer _hdrBuffer;
+		OutputBuffer _srcBuffer;
+		std::ostream* _hdr = 0;
+		std::ostream* _src = 0;
+		bool _inMemory = false;
 
 		std::string _hdrFileName;
 		std::string _srcFileName;
+		std::string _hdrPath;
+		std::string _srcPath;
+		bool _writeIfChanged = false;
+
+		void _writeFile( OutputBuffer const& buffer, std::string const& path,
+						 std::string const& fileName ) const;
 	};
 }
 #endif // VKDUALOFSTREAM_H
@@ -0,0 +1,146 @@
+// Copyright(c) 2015-2016, NVIDIA CORPORATION. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "VkMappedFile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace vk
+{
+	MappedFile::~MappedFile()
+	{
+		_close();
+	}
+	//--------------------------------------------------------------------------
+#ifdef _WIN32
+	bool MappedFile::open( std::string const& filename )
+	{
+		_close();
+
+		HANDLE file = CreateFileA( filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+								   OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr );
+		if( file == INVALID_HANDLE_VALUE )
+			return false;
+
+		_file = file;
+		LARGE_INTEGER size;
+		if( !GetFileSizeEx( file, &size ) )
+		{
+			_close();
+			return false;
+		}
+
+		// an empty file can't be mapped, but there is nothing to read anyway
+		if( size.QuadPart == 0 )
+		{
+			_data = "";
+			return true;
+		}
+
+		_mapping = CreateFileMappingA( file, nullptr, PAGE_READONLY, 0, 0, nullptr );
+		if( !_mapping )
+		{
+			_close();
+			return false;
+		}
+
+		_data = static_cast<char const*>( MapViewOfFile( _mapping, FILE_MAP_READ, 0, 0, 0 ) );
+		if( !_data )
+		{
+			_close();
+			return false;
+		}
+		_size = static_cast<size_t>( size.QuadPart );
+		return true;
+	}
+	//--------------------------------------------------------------------------
+	void MappedFile::_close()
+	{
+		if( _data && _size )
+			UnmapViewOfFile( _data );
+
+		if( _mapping )
+			CloseHandle( _mapping );
+
+		if( _file )
+			CloseHandle( _file );
+
+		_data = nullptr;
+		_size = 0;
+		_mapping = nullptr;
+		_file = nullptr;
+	}
+#else
+	bool MappedFile::open( std::string const& filename )
+	{
+		_close();
+
+		int fd = ::open( filename.c_str(), O_RDONLY );
+		if( fd < 0 )
+			return false;
+
+		struct stat st;
+		if( fstat( fd, &st ) != 0 )
+		{
+			::close( fd );
+			return false;
+		}
+
+		// an empty file can't be mapped, but there is nothing to read anyway
+		if( st.st_size == 0 )
+		{
+			::close( fd );
+			_data = "";
+			return true;
+		}
+
+		// the mapping keeps its own reference on the file
+		void* data = mmap( nullptr, static_cast<size_t>( st.st_size ), PROT_READ, MAP_PRIVATE, fd, 0 );
+		::close( fd );
+		if( data == MAP_FAILED )
+			return false;
+
+		_data = static_cast<char const*>( data );
+		_size = static_cast<size_t>( st.st_size );
+		return true;
+	}
+	//--------------------------------------------------------------------------
+	void MappedFile::_close()
+	{
+		if( _data && _size )
+			munmap( const_cast<char*>( _data ), _size );
+
+		_data = nullptr;
+		_size = 0;
+	}
+#endif
+}
@@ -0,0 +1,231 @@
+// Copyright(c) 2015-2016, NVIDIA CORPORATION. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "VkOutputBuffer.h"
+#include "VkMappedFile.h"
+#include <algorithm>
+#include <cassert>
+#include <climits>
+#include <cstring>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <cstdio>
+#include <fstream>
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+namespace vk
+{
+	OutputBuffer::OutputBuffer( size_t blockSize )
+		: _blockSize( blockSize )
+	{
+		assert( blockSize );
+	}
+	//--------------------------------------------------------------------------
+	void OutputBuffer::splice( OutputBuffer& other )
+	{
+		_seal();
+		other._seal();
+		for( auto& block : other._blocks )
+		{
+			if( block.size )
+				_blocks.push_back( std::move( block ) );
+		}
+		other._blocks.clear();
+	}
+	//--------------------------------------------------------------------------
+	size_t OutputBuffer::size() const
+	{
+		size_t size = 0;
+		for( auto& chunk : chunks() )
+			size += chunk.size();
+
+		return size;
+	}
+	//--------------------------------------------------------------------------
+	std::vector<StringRef> OutputBuffer::chunks() const
+	{
+		std::vector<StringRef> chunks;
+		chunks.reserve( _blocks.size() );
+		for( auto& block : _blocks )
+		{
+			// the last block is the one being written to
+			size_t size = ( &block == &_blocks.back() && pbase() ) ? pptr() - pbase() : block.size;
+			if( size )
+				chunks.push_back( StringRef( block.data.get(), size ) );
+		}
+		return chunks;
+	}
+	//--------------------------------------------------------------------------
+#ifdef _WIN32
+	void OutputBuffer::writeFile( std::string const& path ) const
+	{
+		std::string tmpPath = path + ".tmp";
+		std::ofstream ofs( tmpPath, std::ios::binary | std::ios::trunc );
+		for( auto& chunk : chunks() )
+			ofs.write( chunk.data(), chunk.size() );
+
+		ofs.close();
+		if( !ofs )
+		{
+			std::remove( tmpPath.c_str() );
+			throw std::runtime_error( "OutputBuffer: failed to write \"" + tmpPath + "\"" );
+		}
+
+		if( !MoveFileExA( tmpPath.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING ) )
+		{
+			std::remove( tmpPath.c_str() );
+			throw std::runtime_error( "OutputBuffer: failed to replace \"" + path + "\"" );
+		}
+	}
+#else
+	void OutputBuffer::writeFile( std::string const& path ) const
+	{
+		std::string tmpPath = path + ".tmp";
+		int fd = ::open( tmpPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0666 );
+		if( fd < 0 )
+			throw std::runtime_error( "OutputBuffer: failed to open \"" + tmpPath + "\": " + strerror( errno ) );
+
+		std::vector<iovec> iov;
+		for( auto& chunk : chunks() )
+		{
+			iovec v;
+			v.iov_base = const_cast<char*>( chunk.data() );
+			v.iov_len = chunk.size();
+			iov.push_back( v );
+		}
+
+		// writev may stop short, pick up where it left off
+		size_t first = 0;
+		while( first < iov.size() )
+		{
+			int count = static_cast<int>( std::min<size_t>( iov.size() - first, IOV_MAX ) );
+			ssize_t written = writev( fd, &iov[ first ], count );
+			if( written < 0 )
+			{
+				if( errno == EINTR )
+					continue;
+
+				std::string error = strerror( errno );
+				::close( fd );
+				unlink( tmpPath.c_str() );
+				throw std::runtime_error( "OutputBuffer: failed to write \"" + tmpPath + "\": " + error );
+			}
+
+			for( ; first < iov.size() && static_cast<size_t>( written ) >= iov[ first ].iov_len; first++ )
+				written -= iov[ first ].iov_len;
+
+			if( written )
+			{
+				iov[ first ].iov_base = static_cast<char*>( iov[ first ].iov_base ) + written;
+				iov[ first ].iov_len -= written;
+			}
+		}
+
+		if( ::close( fd ) != 0 || rename( tmpPath.c_str(), path.c_str() ) != 0 )
+		{
+			std::string error = strerror( errno );
+			unlink( tmpPath.c_str() );
+			throw std::runtime_error( "OutputBuffer: failed to replace \"" + path + "\": " + error );
+		}
+	}
+#endif
+	//--------------------------------------------------------------------------
+	bool OutputBuffer::matchesFile( std::string const& path ) const
+	{
+		MappedFile file;
+		if( !file.open( path ) || file.size() != size() )
+			return false;
+
+		char const* data = file.data();
+		for( auto& chunk : chunks() )
+		{
+			if( memcmp( data, chunk.data(), chunk.size() ) != 0 )
+				return false;
+
+			data += chunk.size();
+		}
+		return true;
+	}
+	//--------------------------------------------------------------------------
+	OutputBuffer::int_type OutputBuffer::overflow( int_type c )
+	{
+		if( traits_type::eq_int_type( c, traits_type::eof() ) )
+			return traits_type::not_eof( c );
+
+		_newBlock( 1 );
+		*pptr() = traits_type::to_char_type( c );
+		pbump( 1 );
+		return c;
+	}
+	//--------------------------------------------------------------------------
+	std::streamsize OutputBuffer::xsputn( char const* s, std::streamsize n )
+	{
+		size_t size = static_cast<size_t>( n );
+		if( static_cast<size_t>( epptr() - pptr() ) < size )
+			_newBlock( size );
+
+		memcpy( pptr(), s, size );
+
+		// pbump takes an int, a single call can't move past INT_MAX
+		for( size_t left = size; left; )
+		{
+			int step = static_cast<int>( std::min<size_t>( left, INT_MAX ) );
+			pbump( step );
+			left -= step;
+		}
+		return n;
+	}
+	//--------------------------------------------------------------------------
+	void OutputBuffer::_seal()
+	{
+		if( pbase() )
+		{
+			_blocks.back().size = pptr() - pbase();
+			setp( nullptr, nullptr );
+		}
+	}
+	//--------------------------------------------------------------------------
+	void OutputBuffer::_newBlock( size_t minSize )
+	{
+		_seal();
+
+		// oversized writes get a block of their own
+		size_t capacity = std::max( _blockSize, minSize );
+		Block block;
+		block.data.reset( new char[ capacity ] );
+		block.size = 0;
+		_blocks.push_back( std::move( block ) );
+
+		char* data = _blocks.back().data.get();
+		setp( data, data + capacity );
+	}
+}
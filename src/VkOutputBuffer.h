@@ -0,0 +1,97 @@
+// Copyright(c) 2015-2016, NVIDIA CORPORATION. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#ifndef VKOUTPUTBUFFER_H
+#define VKOUTPUTBUFFER_H
+
+#include <memory>
+#include <streambuf>
+#include <string>
+#include <vector>
+#include "VkStringRef.h"
+
+namespace vk
+{
+	/**
+	 * @brief growable in-memory stream buffer.
+	 *
+	 * Text is stored in a list of blocks, so growing never moves what has
+	 * already been written, and buffers can be spliced together without
+	 * copying. Flushing is a no-op: nothing reaches the disk before writeFile.
+	 */
+	class OutputBuffer : public std::streambuf
+	{
+	public:
+		explicit OutputBuffer( size_t blockSize = 64 * 1024 );
+
+		OutputBuffer( OutputBuffer const& ) = delete;
+		OutputBuffer& operator=( OutputBuffer const& ) = delete;
+
+		/**
+		 * @brief move the content of other to the end of this buffer, leaving
+		 * other empty.
+		 */
+		void splice( OutputBuffer& other );
+
+		size_t size() const;
+
+		/**
+		 * @brief the content, in order, one entry per block.
+		 */
+		std::vector<StringRef> chunks() const;
+
+		/**
+		 * @brief replace the given file by the buffer. The content goes to a
+		 * temporary file next to it, with a single writev where available,
+		 * which is then renamed over the target so that readers never see a
+		 * partial file. Throws std::runtime_error on failure.
+		 */
+		void writeFile( std::string const& path ) const;
+
+		/**
+		 * @brief whether the given file exists and holds exactly the buffer.
+		 */
+		bool matchesFile( std::string const& path ) const;
+
+	protected:
+		int_type overflow( int_type c ) override;
+		std::streamsize xsputn( char const* s, std::streamsize n ) override;
+		int sync() override { return 0; }
+
+	private:
+		struct Block
+		{
+			std::unique_ptr<char[]>	data;
+			size_t					size;
+		};
+
+		void _seal();
+		void _newBlock( size_t minSize );
+
+		std::vector<Block>	_blocks;
+		size_t				_blockSize;
+	};
+}
+#endif // VKOUTPUTBUFFER_H
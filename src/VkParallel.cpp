@@ -0,0 +1,83 @@
+// Copyright(c) 2015-2016, NVIDIA CORPORATION. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "VkParallel.h"
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vk
+{
+	void parallelFor( size_t count, unsigned threads, std::function<void( size_t )> const& task )
+	{
+		size_t workerCount = std::min<size_t>( std::max( threads, 1u ), count );
+		if( workerCount <= 1 )
+		{
+			for( size_t i = 0; i < count; i++ )
+				task( i );
+
+			return;
+		}
+
+		std::atomic<size_t> next( 0 );
+		std::exception_ptr error;
+		std::mutex errorMutex;
+
+		auto work = [&]()
+		{
+			for( size_t i = next++; i < count; i = next++ )
+			{
+				try
+				{
+					task( i );
+				}
+				catch( ... )
+				{
+					std::lock_guard<std::mutex> lock( errorMutex );
+					if( !error )
+						error = std::current_exception();
+
+					// no point in starting the remaining tasks
+					next = count;
+				}
+			}
+		};
+
+		std::vector<std::thread> workers;
+		workers.reserve( workerCount - 1 );
+		for( size_t i = 1; i < workerCount; i++ )
+			workers.push_back( std::thread( work ) );
+
+		work();
+		for( auto& worker : workers )
+			worker.join();
+
+		if( error )
+			std::rethrow_exception( error );
+	}
+}
@@ -25,21 +25,26 @@
 // OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "VkSpecParser.h"
 #include "StringsHelper.h"
+#include "VkMappedFile.h"
+#include "VkParallel.h"
+#include "VkXmlPullReader.h"
 #include <cassert>
 #include <iostream>
 #include <algorithm>
 #include <sstream>
 #include <iomanip>
+#include <iterator>
+#include <stdexcept>
 
 #define EXT_BASE 1000000000
 #define EXT_BLOCK_SIZE 1000
 
 namespace vk
 {
-	void EnumData::addEnum( std::string const& name, std::string const& value,
+	void EnumData::addEnum( StringRef name, std::string const& value,
 							std::string const& tag, bool appendTag )
 	{
-		assert( value.empty() || tag.empty() || name.find( tag ) != std::string::npos );
+		assert( value.empty() || tag.empty() || name.find( tag ) != StringRef::npos );
 		members.push_back( NameValue() );
 		members.back().name = "e" + StringsHelper::toCamelCase( StringsHelper::strip( name, prefix, tag ) );
 		members.back().value = value + ", //" + name;
@@ -54,72 +59,211 @@ namespace vk
 	}
 	//--------------------------------------------------------------------------
 	//--------------------------------------------------------------------------
-	SpecParser::SpecParser()
+	DependencyData& SpecData::addDependency( DependencyData::Category category,
+											 std::string const& name )
+	{
+		dependencies.push_back( DependencyData( category, name, symbols, arena ) );
+
+		SymbolTable::Id id = dependencies.back().symbol;
+		if( _dependencyIndex.size() <= id )
+			_dependencyIndex.resize( symbols.size(), dependencies.end() );
+
+		// like a linear search would, keep the first entry of a given name
+		if( _dependencyIndex[ id ] == dependencies.end() )
+			_dependencyIndex[ id ] = std::prev( dependencies.end() );
+
+		return dependencies.back();
+	}
+	//--------------------------------------------------------------------------
+	DependencyList::iterator SpecData::findDependency( SymbolTable::Id id )
+	{
+		return id < _dependencyIndex.size() ? _dependencyIndex[ id ] : dependencies.end();
+	}
+	//--------------------------------------------------------------------------
+	void SpecData::eraseDependency( DependencyList::iterator it )
+	{
+		assert( findDependency( it->symbol ) == it );
+		_dependencyIndex[ it->symbol ] = dependencies.end();
+		dependencies.erase( it );
+	}
+	//--------------------------------------------------------------------------
+	void SpecData::merge( std::unique_ptr<SpecData> part )
+	{
+		// interning the names in the order they were seen by the part gives
+		// them the ids they would have got if it had been read into this model
+		std::vector<SymbolTable::Id> ids( part->symbols.size() );
+		for( SymbolTable::Id id = 0; id < ids.size(); id++ )
+			ids[ id ] = symbols.intern( part->symbols.name( id ) );
+
+		for( auto& dependency : part->dependencies )
+		{
+			DependencyData& merged = addDependency( dependency.category, dependency.name );
+			for( auto id : dependency.dependencies )
+				merged.dependencies.insert( ids[ id ] );
+		}
+
+		// the values keep drawing from the arena of the part, which is kept alive below
+		for( auto& command : part->commands )
+			commands.insert( std::make_pair( command.first, command.second ) );
+
+		for( auto& enumData : part->enums )
+		{
+			assert( enums.find( enumData.first ) == enums.end() );
+			enums.insert( std::make_pair( enumData.first, enumData.second ) );
+		}
+
+		for( auto& flag : part->flags )
+			flags.insert( std::make_pair( flag.first, flag.second ) );
+
+		for( auto& handle : part->handles )
+			handles.insert( std::make_pair( handle.first, handle.second ) );
+
+		for( auto& scalar : part->scalars )
+			scalars.insert( std::make_pair( scalar.first, scalar.second ) );
+
+		for( auto& structData : part->structs )
+			structs.insert( std::make_pair( structData.first, structData.second ) );
+
+		vkTypes.insert( part->vkTypes.begin(), part->vkTypes.end() );
+		assert( part->vulkanLicenseHeader.empty() );
+
+		if( !part->typesafeCheck.empty() )
+			typesafeCheck = part->typesafeCheck;
+
+		if( !part->version.empty() )
+			version = part->version;
+
+		_parts.push_back( std::move( part ) );
+	}
+	//--------------------------------------------------------------------------
+	SpecParser::SpecParser( unsigned threads )
+		: _threads( threads )
 	{}
 	//--------------------------------------------------------------------------
-	SpecData* SpecParser::parse( const std::string& filename ) const
+	std::unique_ptr<SpecData> SpecParser::parse( const std::string& filename ) const
 	{
-		SpecData* vkData = 0;
+		std::unique_ptr<SpecData> vkData;
 
 		try
 		{
-			tinyxml2::XMLDocument doc;
+			std::unique_ptr<tinyxml2::XMLDocument> doc( new tinyxml2::XMLDocument );
 			std::cout << "Parsing Vulkan specs from file \"" << filename << "\"\n";
 
-			auto error = doc.LoadFile( filename.c_str() );
+			auto error = doc->LoadFile( filename.c_str() );
 			if( error != tinyxml2::XML_SUCCESS )
 			{
 				std::cerr << "VkSpecParser: failed to load file \"" << filename
 						  << "\". Error code: " << error << std::endl;
-				return 0;
+				return nullptr;
 			}
 
-			auto registryElement = doc.FirstChildElement();
+			auto registryElement = doc->FirstChildElement();
 			assert( strcmp( registryElement->Value(), "registry" ) == 0 );
 			assert( !registryElement->NextSiblingElement() );
 
-			vkData = new SpecData;
+			std::vector<tinyxml2::XMLElement*> sections;
 			auto child = registryElement->FirstChildElement();
 			do
 			{
-				assert( child->Value() );
-				const std::string value = child->Value();
-				if( value == "commands" )
-					_readCommands( child, vkData );
+				sections.push_back( child );
+			} while( child = child->NextSiblingElement() );
+
+			vkData.reset( new SpecData );
+			_readRegistry( sections, vkData.get() );
+			vkData->documents.push_back( std::move( doc ) );
+		}
+		catch( const std::exception& e )
+		{
+			std::cerr << "VkSpecParser caught an exception: " << e.what() << std::endl;
+			return nullptr;
+		}
+		catch( ... )
+		{
+			std::cerr << "VkSpecParser caught an unknown exception" << std::endl;
+			return nullptr;
+		}
 
-				else if( value == "comment" )
-					_readComment( child, vkData->vulkanLicenseHeader );
+		return vkData;
+	}
+	//--------------------------------------------------------------------------
+	std::unique_ptr<SpecData> SpecParser::parseMapped( const std::string& filename ) const
+	{
+		std::unique_ptr<SpecData> vkData;
 
-				else if( value == "enums" )
-					_readEnums( child, vkData );
+		try
+		{
+			MappedFile file;
+			std::cout << "Parsing Vulkan specs from mapped file \"" << filename << "\"\n";
 
-				else if( value == "extensions" )
-					_readExtensions( child, vkData );
+			if( !file.open( filename ) )
+			{
+				std::cerr << "VkSpecParser: failed to map file \"" << filename << "\"" << std::endl;
+				return nullptr;
+			}
 
-				else if( value == "tags" )
-					_readTags( child, vkData->tags );
+			XmlPullReader reader( file.data(), file.data() + file.size() );
+			XmlPullReader::Event event;
+			while( ( event = reader.next() ) != XmlPullReader::Event::START_ELEMENT )
+			{
+				if( event == XmlPullReader::Event::END_OF_INPUT )
+					throw std::runtime_error( "VkSpecParser: no registry element" );
+			}
+			assert( reader.name() == "registry" );
 
-				else if( value == "types" )
-					_readTypes( child, vkData );
-				else
-					assert( value == "feature" || value == "vendorids" );
-			} while( child = child->NextSiblingElement() );
+			std::vector<StringRef> ranges;
+			while( ( event = reader.next() ) != XmlPullReader::Event::END_ELEMENT )
+			{
+				if( event == XmlPullReader::Event::END_OF_INPUT )
+					throw std::runtime_error( "VkSpecParser: unterminated registry element" );
+
+				if( event != XmlPullReader::Event::START_ELEMENT )
+					continue;
+
+				char const* sectionBegin = reader.tokenBegin();
+				StringRef name = reader.name();
+				reader.skipElement();
+				if( name != "feature" && name != "vendorids" )
+					ranges.push_back( StringRef( sectionBegin, reader.tokenEnd() - sectionBegin ) );
+			}
+
+			// tinyxml2 copies each section, the mapping can go away with file
+			vkData.reset( new SpecData );
+			vkData->documents.resize( ranges.size() );
+			parallelFor( ranges.size(), _threads, [&]( size_t i )
+			{
+				std::unique_ptr<tinyxml2::XMLDocument> doc( new tinyxml2::XMLDocument );
+				auto error = doc->Parse( ranges[ i ].data(), ranges[ i ].size() );
+				if( error != tinyxml2::XML_SUCCESS )
+				{
+					std::stringstream ss;
+					ss << "VkSpecParser: failed to parse section at offset " << ( ranges[ i ].data() - file.data() )
+					   << " of file \"" << filename << "\". Error code: " << error;
+					throw std::runtime_error( ss.str() );
+				}
+				vkData->documents[ i ] = std::move( doc );
+			} );
+
+			std::vector<tinyxml2::XMLElement*> sections;
+			for( auto& doc : vkData->documents )
+				sections.push_back( doc->FirstChildElement() );
+
+			_readRegistry( sections, vkData.get() );
 		}
 		catch( const std::exception& e )
 		{
 			std::cerr << "VkSpecParser caught an exception: " << e.what() << std::endl;
-			return 0;
+			return nullptr;
 		}
 		catch( ... )
 		{
 			std::cerr << "VkSpecParser caught an unknown exception" << std::endl;
-			return 0;
+			return nullptr;
 		}
 
 		return vkData;
 	}
 	//--------------------------------------------------------------------------
-	std::string SpecParser::_getEnumName( std::string const& name ) const
+	std::string SpecParser::_getEnumName( StringRef name ) const
 	{
 		return StringsHelper::strip( name, "Vk" );
 	}
@@ -158,7 +302,7 @@ namespace vk
 		return ss.str();
 	}
 	//--------------------------------------------------------------------------
-	std::string SpecParser::_stripCommand( std::string const& value ) const
+	std::string SpecParser::_stripCommand( StringRef value ) const
 	{
 		std::string stripped = StringsHelper::strip( value, "vk" );
 		assert( isupper( stripped[ 0 ] ) );
@@ -166,12 +310,12 @@ namespace vk
 		return stripped;
 	}
 	//--------------------------------------------------------------------------
-	std::string SpecParser::_findTag( std::string const& name, std::set<std::string> const& tags ) const
+	std::string SpecParser::_findTag( StringRef name, std::set<std::string> const& tags ) const
 	{
 		for( auto& it : tags )
 		{
 			size_t pos = name.find( it );
-			if( pos != std::string::npos && ( pos == name.length() - it.length() ) )
+			if( pos != StringRef::npos && ( pos == name.length() - it.length() ) )
 				return it;
 		}
 		return "";
@@ -214,20 +358,20 @@ namespace vk
 		auto child = element->FirstChildElement();
 		assert( child && strcmp( child->Value(), "proto" ) == 0 );
 
-		std::map<std::string, CommandData>::iterator it = _readCommandProto( child, vkData );
+		SymbolMap<CommandData>::iterator it = _readCommandProto( child, vkData );
 
 		if( element->Attribute( "successcodes" ) )
 		{
-			std::string successCodes = element->Attribute( "successcodes" );
+			StringRef successCodes = element->Attribute( "successcodes" );
 			size_t start = 0, end;
 			do
 			{
 				end = successCodes.find( ',', start );
-				std::string code = successCodes.substr( start, end - start );
+				StringRef code = successCodes.substr( start, end - start );
 				std::string tag = _findTag( code, vkData->tags );
 				it->second.successCodes.push_back( "e" + StringsHelper::toCamelCase( StringsHelper::strip( code, "VK_", tag ) ) + tag );
 				start = end + 1;
-			} while( end != std::string::npos );
+			} while( end != StringRef::npos );
 		}
 
 		// HACK: the current vk.xml misses to specify successcodes on command vkCreateDebugReportCallbackEXT!
@@ -239,7 +383,7 @@ namespace vk
 
 		while( child = child->NextSiblingElement() )
 		{
-			std::string value = child->Value();
+			StringRef value = child->Value();
 			if( value == "param" )
 				it->second.twoStep |= _readCommandParam( child, vkData->dependencies.back(), it->second.arguments );
 			else
@@ -251,26 +395,31 @@ namespace vk
 			it->second.twoStep = true;
 
 		assert( !it->second.arguments.empty() );
-		auto hit = vkData->handles.find( it->second.arguments[ 0 ].pureType );
-		if( hit != vkData->handles.end() )
-		{
-			hit->second.commands.push_back( it->first );
-			it->second.handleCommand = true;
-			DependencyData const& dep = vkData->dependencies.back();
-			auto dit = std::find_if(
-						   vkData->dependencies.begin(),
-						   vkData->dependencies.end(),
-						   [ hit ]( DependencyData const& dd ) { return dd.name == hit->first; }
-			);
-			for( auto& depit : dep.dependencies )
+	}
+	//--------------------------------------------------------------------------
+	void SpecParser::_linkHandleCommands( SpecData* vkData ) const
+	{
+		for( auto& command : vkData->commands )
+		{
+			auto hit = vkData->handles.find( command.second.arguments[ 0 ].pureType );
+			if( hit == vkData->handles.end() )
+				continue;
+
+			hit->second.commands.push_back( command.first );
+			command.second.handleCommand = true;
+			auto cdit = vkData->findDependency( command.first );
+			assert( cdit != vkData->dependencies.end() );
+			SymbolTable::Id handleSymbol = vkData->symbols.find( hit->first );
+			auto dit = vkData->findDependency( handleSymbol );
+			assert( dit != vkData->dependencies.end() );
+			for( auto depit : cdit->dependencies )
 			{
-				if( depit != hit->first )
+				if( depit != handleSymbol )
 					dit->dependencies.insert( depit );
 			}
 		}
-	}
-	//--------------------------------------------------------------------------
-	std::map<std::string, CommandData>::iterator SpecParser::_readCommandProto(
+	}	//--------------------------------------------------------------------------
+	SymbolMap<CommandData>::iterator SpecParser::_readCommandProto(
 			tinyxml2::XMLElement* element, SpecData* vkData ) const
 	{
 		auto typeElement = element->FirstChildElement();
@@ -280,12 +429,12 @@ namespace vk
 		assert( nameElement && ( strcmp( nameElement->Value(), "name" ) == 0 ) );
 		assert( !nameElement->NextSiblingElement() );
 
-		std::string type = StringsHelper::strip( typeElement->GetText(), "Vk" );
+		StringRef type = StringsHelper::strip( typeElement->GetText(), "Vk" );
 		std::string name = _stripCommand( nameElement->GetText() );
 
-		vkData->dependencies.push_back( DependencyData( DependencyData::Category::COMMAND, name ) );
+		vkData->addDependency( DependencyData::Category::COMMAND, name );
 		assert( vkData->commands.find( name ) == vkData->commands.end() );
-		auto it = vkData->commands.insert( std::make_pair( name, CommandData() ) ).first;
+		auto it = vkData->commands.insert( std::make_pair( name, CommandData( vkData->arena ) ) ).first;
 		it->second.returnType = type;
 
 		return it;
@@ -293,7 +442,7 @@ namespace vk
 	//--------------------------------------------------------------------------
 	bool SpecParser::_readCommandParam( tinyxml2::XMLElement* element,
 									   DependencyData& typeData,
-									   std::vector<MemberData>& arguments ) const
+									   ArenaVector<MemberData>& arguments ) const
 	{
 		arguments.push_back( MemberData() );
 		MemberData& arg = arguments.back();
@@ -305,7 +454,7 @@ namespace vk
 		assert( child );
 		if( child->ToText() )
 		{
-			std::string value = StringsHelper::trimEnd( child->Value() );
+			StringRef value = StringsHelper::trimEnd( child->Value() );
 			assert( ( value == "const" ) || ( value == "struct" ) );
 			arg.type = value + " ";
 			child = child->NextSibling();
@@ -314,7 +463,7 @@ namespace vk
 
 		assert( child->ToElement() );
 		assert( strcmp( child->Value(), "type" ) == 0 && child->ToElement() && child->ToElement()->GetText() );
-		std::string type = StringsHelper::strip( child->ToElement()->GetText(), "Vk" );
+		StringRef type = StringsHelper::strip( child->ToElement()->GetText(), "Vk" );
 		typeData.dependencies.insert( type );
 		arg.type += type;
 		arg.pureType = type;
@@ -323,7 +472,7 @@ namespace vk
 		assert( child );
 		if( child->ToText() )
 		{
-			std::string value = StringsHelper::trimEnd( child->Value() );
+			StringRef value = StringsHelper::trimEnd( child->Value() );
 			assert( value == "*" || value == "**" || value == "* const*" );
 			arg.type += value;
 			child = child->NextSibling();
@@ -338,7 +487,7 @@ namespace vk
 			size_t pos = arg.name.find( '[' );
 			assert( pos != std::string::npos );
 			arg.arraySize = arg.name.substr( pos + 1, arg.name.length() - 2 - pos );
-			arg.name.erase( pos );
+			arg.name = arg.name.substr( 0, pos );
 		}
 
 		child = child->NextSibling();
@@ -346,7 +495,7 @@ namespace vk
 		{
 			if( child->ToText() )
 			{
-				std::string value = child->Value();
+				StringRef value = child->Value();
 				if( value == "[" )
 				{
 					child = child->NextSibling();
@@ -388,6 +537,74 @@ namespace vk
 		header += "\n\n// This header has been auto-generated from the Khronos Vulkan XML API Registry.";
 	}
 	//--------------------------------------------------------------------------
+	void SpecParser::_readRegistry( std::vector<tinyxml2::XMLElement*> const& sections,
+									SpecData* vkData ) const
+	{
+		if( _threads <= 1 )
+		{
+			for( auto section : sections )
+				_readRegistryChild( section, vkData );
+		}
+		else
+		{
+			// tags are needed by the enums and the commands, and extensions
+			// patch commands and enums: those are read on this thread
+			std::vector<tinyxml2::XMLElement*> independent, extensions;
+			for( auto section : sections )
+			{
+				StringRef value = section->Value();
+				if( value == "comment" || value == "tags" )
+					_readRegistryChild( section, vkData );
+
+				else if( value == "extensions" )
+					extensions.push_back( section );
+
+				else
+					independent.push_back( section );
+			}
+
+			std::vector<std::unique_ptr<SpecData>> parts( independent.size() );
+			parallelFor( independent.size(), _threads, [&]( size_t i )
+			{
+				parts[ i ].reset( new SpecData );
+				parts[ i ]->tags = vkData->tags;
+				_readRegistryChild( independent[ i ], parts[ i ].get() );
+			} );
+
+			// merging in document order gives the same model as a serial read
+			for( auto& part : parts )
+				vkData->merge( std::move( part ) );
+
+			for( auto section : extensions )
+				_readRegistryChild( section, vkData );
+		}
+
+		_linkHandleCommands( vkData );
+	}	//--------------------------------------------------------------------------
+	void SpecParser::_readRegistryChild( tinyxml2::XMLElement* element, SpecData* vkData ) const
+	{
+		assert( element->Value() );
+		const StringRef value = element->Value();
+		if( value == "commands" )
+			_readCommands( element, vkData );
+
+		else if( value == "comment" )
+			_readComment( element, vkData->vulkanLicenseHeader );
+
+		else if( value == "enums" )
+			_readEnums( element, vkData );
+
+		else if( value == "extensions" )
+			_readExtensions( element, vkData );
+
+		else if( value == "tags" )
+			_readTags( element, vkData->tags );
+
+		else if( value == "types" )
+			_readTypes( element, vkData );
+		else
+			assert( value == "feature" || value == "vendorids" );
+	}	//--------------------------------------------------------------------------
 	void SpecParser::_readEnums( tinyxml2::XMLElement* element, SpecData* vkData ) const
 	{
 		assert( element->Attribute( "name" ) );
@@ -395,8 +612,8 @@ namespace vk
 		if( name == "API Constants" )
 			return;
 
-		vkData->dependencies.push_back( DependencyData( DependencyData::Category::ENUM, name ) );
-		auto it = vkData->enums.insert( std::make_pair( name, EnumData() ) ).first;
+		vkData->addDependency( DependencyData::Category::ENUM, name );
+		auto it = vkData->enums.insert( std::make_pair( name, EnumData( vkData->arena ) ) ).first;
 		std::string tag;
 
 		if( name == "Result" )
@@ -499,7 +716,7 @@ namespace vk
 		auto child = element->FirstChildElement();
 		do
 		{
-			std::string value = child->Value();
+			StringRef value = child->Value();
 
 			if( value == "command" )
 			{
@@ -519,7 +736,7 @@ namespace vk
 
 				else
 				{
-					std::map<std::string, FlagData>::iterator fit = vkData->flags.find( name );
+					SymbolMap<FlagData>::iterator fit = vkData->flags.find( name );
 					if( fit != vkData->flags.end() )
 					{
 						fit->second.protect = protect;
@@ -554,7 +771,7 @@ namespace vk
 					auto enumName = _getEnumName( child->Attribute( "extends" ) );
 					assert( vkData->enums.find( enumName ) != vkData->enums.end() );
 
-					vkData->enums[ enumName ].addEnum(
+					vkData->enums.find( enumName )->second.addEnum(
 								child->Attribute( "name" ),
 								_getEnumValue( child ),
 								child->Attribute( "value" ) ? "" : tag,
@@ -591,9 +808,9 @@ namespace vk
 			assert( type == "type" );
 			if( child->Attribute( "category" ) )
 			{
-				std::string category = child->Attribute( "category" );
+				StringRef category = child->Attribute( "category" );
 				if( category == "basetype" )
-					_readTypeBasetype( child, vkData->dependencies );
+					_readTypeBasetype( child, vkData );
 
 				else if( category == "bitmask" )
 					_readTypeBitmask( child, vkData );
@@ -602,7 +819,7 @@ namespace vk
 					_readTypeDefine( child, vkData );
 
 				else if( category == "funcpointer" )
-					_readTypeFuncpointer( child, vkData->dependencies );
+					_readTypeFuncpointer( child, vkData );
 
 				else if( category == "handle" )
 					_readTypeHandle( child, vkData );
@@ -619,13 +836,12 @@ namespace vk
 			else
 			{
 				assert( child->Attribute( "requires" ) && child->Attribute( "name" ) );
-				vkData->dependencies.push_back( DependencyData( DependencyData::Category::REQUIRED, child->Attribute( "name" ) ) );
+				vkData->addDependency( DependencyData::Category::REQUIRED, child->Attribute( "name" ) );
 			}
 		} while( child = child->NextSiblingElement() );
 	}
 	//--------------------------------------------------------------------------
-	void SpecParser::_readTypeBasetype( tinyxml2::XMLElement* element,
-									   std::list<DependencyData>& dependencies ) const
+	void SpecParser::_readTypeBasetype( tinyxml2::XMLElement* element, SpecData* vkData ) const
 	{
 		auto typeElement = element->FirstChildElement();
 		assert( typeElement && strcmp( typeElement->Value(), "type" ) == 0 && typeElement->GetText() );
@@ -639,8 +855,8 @@ namespace vk
 		// skip "Flags",
 		if( name != "Flags" )
 		{
-			dependencies.push_back( DependencyData( DependencyData::Category::SCALAR, name ) );
-			dependencies.back().dependencies.insert( type );
+			vkData->addDependency( DependencyData::Category::SCALAR, name );
+			vkData->dependencies.back().dependencies.insert( type );
 		}
 		else
 			assert( type == "uint32_t" );
@@ -669,13 +885,13 @@ namespace vk
 		{
 			// Generate FlagBits name
 			requires = _generateEnumNameForFlags( name );
-			vkData->dependencies.push_back( DependencyData( DependencyData::Category::ENUM, requires ) );
-			std::map<std::string, EnumData>::iterator it = vkData->enums.insert( std::make_pair( requires, EnumData() ) ).first;
+			vkData->addDependency( DependencyData::Category::ENUM, requires );
+			SymbolMap<EnumData>::iterator it = vkData->enums.insert( std::make_pair( requires, EnumData( vkData->arena ) ) ).first;
 			it->second.bitmask = true;
 			vkData->vkTypes.insert( requires );
 		}
 
-		vkData->dependencies.push_back( DependencyData( DependencyData::Category::FLAGS, name ) );
+		vkData->addDependency( DependencyData::Category::FLAGS, name );
 		vkData->dependencies.back().dependencies.insert( requires );
 		vkData->flags.insert( std::make_pair( name, FlagData() ) );
 
@@ -698,12 +914,11 @@ namespace vk
 		}
 	}
 	//--------------------------------------------------------------------------
-	void SpecParser::_readTypeFuncpointer( tinyxml2::XMLElement* element,
-										  std::list<DependencyData>& dependencies ) const
+	void SpecParser::_readTypeFuncpointer( tinyxml2::XMLElement* element, SpecData* vkData ) const
 	{
 		auto child = element->FirstChildElement();
 		assert( child && strcmp( child->Value(), "name" ) == 0 && child->GetText() );
-		dependencies.push_back( DependencyData( DependencyData::Category::FUNC_POINTER, child->GetText() ) );
+		vkData->addDependency( DependencyData::Category::FUNC_POINTER, child->GetText() );
 	}
 	//--------------------------------------------------------------------------
 	void SpecParser::_readTypeHandle( tinyxml2::XMLElement* element, SpecData* vkData ) const
@@ -719,12 +934,12 @@ namespace vk
 		assert( nameElement && strcmp( nameElement->Value(), "name" ) == 0 && nameElement->GetText() );
 		std::string name = StringsHelper::strip( nameElement->GetText(), "Vk" );
 
-		vkData->dependencies.push_back( DependencyData( DependencyData::Category::HANDLE, name ) );
+		vkData->addDependency( DependencyData::Category::HANDLE, name );
 
 		assert( vkData->vkTypes.find( name ) == vkData->vkTypes.end() );
 		vkData->vkTypes.insert( name );
 		assert( vkData->handles.find( name ) == vkData->handles.end() );
-		vkData->handles[ name ];    // add this to the handles map
+		vkData->handles.insert( std::make_pair( name, HandleData( vkData->arena ) ) );
 	}
 	//--------------------------------------------------------------------------
 	void SpecParser::_readTypeStruct( tinyxml2::XMLElement* element, SpecData* vkData ) const
@@ -738,17 +953,17 @@ namespace vk
 		if( name == "Rect3D" )
 			return;
 
-		vkData->dependencies.push_back( DependencyData( DependencyData::Category::STRUCT, name ) );
+		vkData->addDependency( DependencyData::Category::STRUCT, name );
 
 		assert( vkData->structs.find( name ) == vkData->structs.end() );
-		std::map<std::string, StructData>::iterator it = vkData->structs.insert( std::make_pair( name, StructData() ) ).first;
+		SymbolMap<StructData>::iterator it = vkData->structs.insert( std::make_pair( name, StructData( vkData->arena ) ) ).first;
 		it->second.returnedOnly = !!element->Attribute( "returnedonly" );
 
 		auto child = element->FirstChildElement();
 		do
 		{
 			assert( child->Value() );
-			std::string value = child->Value();
+			StringRef value = child->Value();
 			if( value == "member" )
 				_readTypeStructMember( child, it->second.members, vkData->dependencies.back().dependencies );
 
@@ -762,17 +977,20 @@ namespace vk
 	}
 	//--------------------------------------------------------------------------
 	void SpecParser::_readTypeStructMember( tinyxml2::XMLElement* element,
-										   std::vector<MemberData>& members,
-										   std::set<std::string>& dependencies ) const
+										   ArenaVector<MemberData>& members,
+										   SymbolSet& dependencies ) const
 	{
 		members.push_back( MemberData() );
 		MemberData& member = members.back();
 
+		if( element->Attribute( "len" ) )
+			member.len = element->Attribute( "len" );
+
 		auto child = element->FirstChild();
 		assert( child );
 		if( child->ToText() )
 		{
-			std::string value = StringsHelper::trimEnd( child->Value() );
+			StringRef value = StringsHelper::trimEnd( child->Value() );
 			assert( value == "const" || value == "struct" );
 			member.type = value + " ";
 			child = child->NextSibling();
@@ -781,7 +999,7 @@ namespace vk
 
 		assert( child->ToElement() );
 		assert( strcmp( child->Value(), "type" ) == 0 && child->ToElement() && child->ToElement()->GetText() );
-		std::string type = StringsHelper::strip( child->ToElement()->GetText(), "Vk" );
+		StringRef type = StringsHelper::strip( child->ToElement()->GetText(), "Vk" );
 		dependencies.insert( type );
 		member.type += type;
 		member.pureType = type;
@@ -790,7 +1008,7 @@ namespace vk
 		assert( child );
 		if( child->ToText() )
 		{
-			std::string value = StringsHelper::trimEnd( child->Value() );
+			StringRef value = StringsHelper::trimEnd( child->Value() );
 			assert( value == "*" ||  value == "**" || value == "* const*" );
 			member.type += value;
 			child = child->NextSibling();
@@ -805,7 +1023,7 @@ namespace vk
 			size_t pos = member.name.find( '[' );
 			assert( pos != std::string::npos );
 			member.arraySize = member.name.substr( pos + 1, member.name.length() - 2 - pos );
-			member.name.erase( pos );
+			member.name = member.name.substr( 0, pos );
 		}
 
 		child = child->NextSibling();
@@ -814,7 +1032,7 @@ namespace vk
 
 		assert( member.arraySize.empty() );
 
-		std::string value = child->Value();
+		StringRef value = child->Value();
 		if( value == "[" )
 		{
 			child = child->NextSibling();
@@ -838,10 +1056,10 @@ namespace vk
 		assert( element->Attribute( "name" ) );
 		std::string name = StringsHelper::strip( element->Attribute( "name" ), "Vk" );
 
-		vkData->dependencies.push_back( DependencyData( DependencyData::Category::UNION, name ) );
+		vkData->addDependency( DependencyData::Category::UNION, name );
 
 		assert( vkData->structs.find( name ) == vkData->structs.end() );
-		auto it = vkData->structs.insert( std::make_pair( name, StructData() ) ).first;
+		auto it = vkData->structs.insert( std::make_pair( name, StructData( vkData->arena ) ) ).first;
 
 		auto child = element->FirstChildElement();
 		do
@@ -855,8 +1073,8 @@ namespace vk
 	}
 	//--------------------------------------------------------------------------
 	void SpecParser::_readTypeUnionMember( tinyxml2::XMLElement* element,
-										  std::vector<MemberData>& members,
-										  std::set<std::string>& dependencies ) const
+										  ArenaVector<MemberData>& members,
+										  SymbolSet& dependencies ) const
 	{
 		members.push_back( MemberData() );
 		MemberData& member = members.back();
@@ -873,7 +1091,7 @@ namespace vk
 
 		assert( child->ToElement() );
 		assert( strcmp( child->Value(), "type" ) == 0 && child->ToElement() && child->ToElement()->GetText() );
-		std::string type = StringsHelper::strip( child->ToElement()->GetText(), "Vk" );
+		StringRef type = StringsHelper::strip( child->ToElement()->GetText(), "Vk" );
 		dependencies.insert( type );
 		member.type += type;
 		member.pureType = type;
@@ -882,7 +1100,7 @@ namespace vk
 		assert( child );
 		if( child->ToText() )
 		{
-			std::string value = child->Value();
+			StringRef value = child->Value();
 			assert( value == "*" || value == "**" || value == "* const*" );
 			member.type += value;
 			child = child->NextSibling();
@@ -897,14 +1115,14 @@ namespace vk
 			size_t pos = member.name.find( '[' );
 			assert( pos != std::string::npos );
 			member.arraySize = member.name.substr( pos + 1, member.name.length() - 2 - pos );
-			member.name.erase( pos );
+			member.name = member.name.substr( 0, pos );
 		}
 
 		child = child->NextSibling();
 		if( !child || !child->ToText() )
 			return;
 
-		std::string value = child->Value();
+		StringRef value = child->Value();
 		if( value == "[" )
 		{
 			child = child->NextSibling();
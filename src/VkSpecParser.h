@@ -32,29 +32,39 @@
 #include <set>
 #include <map>
 #include <list>
+#include <memory>
+#include "VkArena.h"
+#include "VkStringRef.h"
+#include "VkSymbolTable.h"
 
 namespace vk
 {
+	template<typename T>
+	using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+	// name, arraySize, pureType and len refer to the text of SpecData::documents
 	struct MemberData
 	{
 		std::string type;
-		std::string name;
-		std::string arraySize;
-		std::string pureType;
-		std::string len;
+		StringRef	name;
+		StringRef	arraySize;
+		StringRef	pureType;
+		StringRef	len;
 		bool		optional;
 	};
 
 	struct CommandData
 	{
-		CommandData()
-			: handleCommand( false ),
+		CommandData( Arena& arena )
+			: arguments( arena ),
+			successCodes( arena ),
+			handleCommand( false ),
 			twoStep( false )
 		{}
 
-		std::string					returnType;
-		std::vector<MemberData>		arguments;
-		std::vector<std::string>	successCodes;
+		StringRef					returnType;
+		ArenaVector<MemberData>		arguments;
+		ArenaVector<std::string>	successCodes;
 		std::string					protect;
 		bool						handleCommand;
 		bool						twoStep;
@@ -75,14 +85,17 @@ namespace vk
 			UNION
 		};
 
-		DependencyData( Category c, std::string const& n )
+		DependencyData( Category c, std::string const& n, SymbolTable& symbols, Arena& arena )
 			: category( c ),
-			name( n )
+			name( n ),
+			symbol( symbols.intern( n ) ),
+			dependencies( symbols, arena )
 		{}
 
-		Category				category;
-		std::string				name;
-		std::set<std::string>	dependencies;
+		Category			category;
+		std::string			name;
+		SymbolTable::Id		symbol;
+		SymbolSet			dependencies;
 	};
 
 	struct NameValue
@@ -91,15 +104,22 @@ namespace vk
 		std::string value;
 	};
 
+	typedef std::list<DependencyData, ArenaAllocator<DependencyData>> DependencyList;
+
 	struct EnumData
 	{
+		EnumData( Arena& arena )
+			: bitmask( false ),
+			members( arena )
+		{}
+
 		bool					bitmask;
 		std::string				prefix;
 		std::string				postfix;
-		std::vector<NameValue>	members;
+		ArenaVector<NameValue>	members;
 		std::string				protect;
 
-		void addEnum( std::string const& name, std::string const& value,
+		void addEnum( StringRef name, std::string const& value,
 					  std::string const& tag,
 					  bool appendTag );
 	};
@@ -111,7 +131,11 @@ namespace vk
 
 	struct HandleData
 	{
-		std::vector<std::string> commands;
+		HandleData( Arena& arena )
+			: commands( arena )
+		{}
+
+		ArenaVector<std::string> commands;
 	};
 
 	struct ScalarData
@@ -121,49 +145,115 @@ namespace vk
 
 	struct StructData
 	{
-		StructData()
-			: returnedOnly( false )
+		StructData( Arena& arena )
+			: returnedOnly( false ),
+			members( arena )
 		{}
 
 		bool					returnedOnly;
-		std::vector<MemberData>	members;
+		ArenaVector<MemberData>	members;
 		std::string				protect;
 	};
 
 	struct SpecData
 	{
-		std::map<std::string, CommandData>	commands;
-		std::list<DependencyData>			dependencies;
-		std::map<std::string, EnumData>		enums;
-		std::map<std::string, FlagData>		flags;
-		std::map<std::string, HandleData>	handles;
-		std::map<std::string, ScalarData>	scalars;
-		std::map<std::string, StructData>	structs;
+		SpecData()
+			: commands( symbols ),
+			dependencies( arena ),
+			enums( symbols ),
+			flags( symbols ),
+			handles( symbols ),
+			scalars( symbols ),
+			structs( symbols )
+		{}
+
+		SpecData( SpecData const& ) = delete;
+		SpecData& operator=( SpecData const& ) = delete;
+
+		/**
+		 * @brief append a new entry to the dependencies list and index it.
+		 */
+		DependencyData& addDependency( DependencyData::Category category,
+									   std::string const& name );
+
+		/**
+		 * @brief get the entry named after the given symbol, or dependencies.end().
+		 * Sorting relinks the list nodes, so the index survives it.
+		 */
+		DependencyList::iterator findDependency( SymbolTable::Id id );
+
+		DependencyList::iterator findDependency( std::string const& name )
+		{
+			return findDependency( symbols.find( name ) );
+		}
+
+		void eraseDependency( DependencyList::iterator it );
+
+		/**
+		 * @brief append a model read from a later part of the registry, as if
+		 * it had been read into this one. The part must not be shared: its
+		 * arena and documents are kept alive by this model.
+		 */
+		void merge( std::unique_ptr<SpecData> part );
+
+	private:
+		// merged parts own memory the values below may still refer to
+		std::vector<std::unique_ptr<SpecData>>	_parts;
+
+	public:
+		// the containers below draw from the arena and every name below is
+		// interned in symbols, keep both first
+		Arena								arena;
+		SymbolTable							symbols;
+
+		SymbolMap<CommandData>				commands;
+		DependencyList						dependencies;
+		SymbolMap<EnumData>					enums;
+		SymbolMap<FlagData>					flags;
+		SymbolMap<HandleData>				handles;
+		SymbolMap<ScalarData>				scalars;
+		SymbolMap<StructData>				structs;
 		std::set<std::string>				tags;
 		std::string							typesafeCheck;
 		std::string							version;
 		std::set<std::string>				vkTypes;
 		std::string							vulkanLicenseHeader;
+
+		// the parsed registry, kept alive for the StringRefs of the model
+		std::vector<std::unique_ptr<tinyxml2::XMLDocument>>	documents;
+
+	private:
+		std::vector<DependencyList::iterator>	_dependencyIndex;
 	};
 
 	class SpecParser
 	{
 	public:
-		SpecParser();
+		/**
+		 * @brief the registry sections are read on up to threads threads.
+		 */
+		explicit SpecParser( unsigned threads = 1 );
+
+		std::unique_ptr<SpecData> parse( const std::string& filename ) const;
 
-		SpecData* parse( const std::string& filename ) const;
+		/**
+		 * @brief same as parse, but the file is memory mapped and scanned with
+		 * a pull reader. Only the registry sections the generator reads are
+		 * turned into a document, one at a time.
+		 */
+		std::unique_ptr<SpecData> parseMapped( const std::string& filename ) const;
 
 	private:
 		/**
 		 * @brief get vkcpp enum name from vk enum name.
 		 */
-		std::string _getEnumName( std::string const& name ) const;
+		std::string _getEnumName( StringRef name ) const;
 
 		std::string _getEnumValue( tinyxml2::XMLElement* element ) const;
 
-		std::string _stripCommand( std::string const& value ) const;
+		std::string _stripCommand( StringRef value ) const;
 
-		std::string _findTag( std::string const& name,
+		std::string _findTag( StringRef name,
 			std::set<std::string> const& tags ) const;
 
 		std::string _extractTag( std::string const& name ) const;
@@ -174,15 +264,32 @@ namespace vk
 
 		void _readCommandsCommand( tinyxml2::XMLElement* element, SpecData* vkData ) const;
 
-		std::map<std::string, CommandData>::iterator _readCommandProto(
+		SymbolMap<CommandData>::iterator _readCommandProto(
 			tinyxml2::XMLElement* element, SpecData* vkData ) const;
 
 		bool _readCommandParam( tinyxml2::XMLElement* element,
 			DependencyData& typeData,
-			std::vector<MemberData>& arguments ) const;
+			ArenaVector<MemberData>& arguments ) const;
 
 		void _readComment( tinyxml2::XMLElement* element, std::string& header ) const;
 
+		/**
+		 * @brief read one of the children of the registry element.
+		 */
+		void _readRegistryChild( tinyxml2::XMLElement* element, SpecData* vkData ) const;
+
+		/**
+		 * @brief read the children of the registry element. Depending on
+		 * _threads, the independent sections are read in parallel.
+		 */
+		void _readRegistry( std::vector<tinyxml2::XMLElement*> const& sections,
+							SpecData* vkData ) const;
+
+		/**
+		 * @brief attach the commands taking a handle as first argument to it.
+		 */
+		void _linkHandleCommands( SpecData* vkData ) const;
+
 		void _readEnums( tinyxml2::XMLElement* element, SpecData* vkData ) const;
 
 		void _readEnumsEnum( tinyxml2::XMLElement* element, EnumData& enumData,
@@ -200,29 +307,29 @@ namespace vk
 
 		void _readTypes( tinyxml2::XMLElement* element, SpecData* vkData ) const;
 
-		void _readTypeBasetype( tinyxml2::XMLElement* element,
-			std::list<DependencyData>& dependencies ) const;
+		void _readTypeBasetype( tinyxml2::XMLElement* element, SpecData* vkData ) const;
 
 		void _readTypeBitmask( tinyxml2::XMLElement* element, SpecData* vkData ) const;
 
 		void _readTypeDefine( tinyxml2::XMLElement* element, SpecData* vkData ) const;
 
-		void _readTypeFuncpointer( tinyxml2::XMLElement* element,
-			std::list<DependencyData>& dependencies ) const;
+		void _readTypeFuncpointer( tinyxml2::XMLElement* element, SpecData* vkData ) const;
 
 		void _readTypeHandle( tinyxml2::XMLElement* element, SpecData* vkData ) const;
 
 		void _readTypeStruct( tinyxml2::XMLElement* element, SpecData* vkData ) const;
 
 		void _readTypeStructMember( tinyxml2::XMLElement* element,
-			std::vector<MemberData>& members,
-			std::set<std::string>& dependencies ) const;
+			ArenaVector<MemberData>& members,
+			SymbolSet& dependencies ) const;
 
 		void _readTypeUnion( tinyxml2::XMLElement* element, SpecData* vkData ) const;
 
 		void _readTypeUnionMember( tinyxml2::XMLElement* element,
-			std::vector<MemberData>& members,
-			std::set<std::string>& dependencies ) const;
+			ArenaVector<MemberData>& members,
+			SymbolSet& dependencies ) const;
+
+		unsigned _threads;
 	};
 }
 #endif // VKSPECPARSER_H
@@ -0,0 +1,118 @@
+// Copyright(c) 2015-2016, NVIDIA CORPORATION. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "VkStringRef.h"
+#include <algorithm>
+#include <ostream>
+
+namespace vk
+{
+	const size_t StringRef::npos;
+	//--------------------------------------------------------------------------
+	size_t StringRef::find( char c, size_t pos ) const
+	{
+		if( pos >= _size )
+			return npos;
+
+		auto p = static_cast<char const*>( memchr( _data + pos, c, _size - pos ) );
+		return p ? p - _data : npos;
+	}
+	//--------------------------------------------------------------------------
+	size_t StringRef::find( StringRef value, size_t pos ) const
+	{
+		if( pos > _size )
+			return npos;
+
+		auto p = std::search( begin() + pos, end(), value.begin(), value.end() );
+		return ( p == end() && !value.empty() ) ? npos : p - _data;
+	}
+	//--------------------------------------------------------------------------
+	size_t StringRef::rfind( StringRef value ) const
+	{
+		if( value.size() > _size )
+			return npos;
+
+		for( size_t pos = _size - value.size() + 1; pos-- > 0; )
+		{
+			if( memcmp( _data + pos, value.data(), value.size() ) == 0 )
+				return pos;
+		}
+		return npos;
+	}
+	//--------------------------------------------------------------------------
+	StringRef StringRef::substr( size_t pos, size_t count ) const
+	{
+		pos = std::min( pos, _size );
+		return StringRef( _data + pos, std::min( count, _size - pos ) );
+	}
+	//--------------------------------------------------------------------------
+	int StringRef::compare( StringRef rhs ) const
+	{
+		int result = memcmp( _data, rhs._data, std::min( _size, rhs._size ) );
+		if( result )
+			return result;
+
+		return _size < rhs._size ? -1 : ( _size > rhs._size ? 1 : 0 );
+	}
+	//--------------------------------------------------------------------------
+	std::string operator+( StringRef lhs, StringRef rhs )
+	{
+		std::string result;
+		result.reserve( lhs.size() + rhs.size() );
+		result.append( lhs.data(), lhs.size() );
+		result.append( rhs.data(), rhs.size() );
+		return result;
+	}
+	//--------------------------------------------------------------------------
+	std::string operator+( std::string const& lhs, StringRef rhs )
+	{
+		return StringRef( lhs ) + rhs;
+	}
+	//--------------------------------------------------------------------------
+	std::string operator+( StringRef lhs, std::string const& rhs )
+	{
+		return lhs + StringRef( rhs );
+	}
+	//--------------------------------------------------------------------------
+	std::string operator+( char const* lhs, StringRef rhs )
+	{
+		return StringRef( lhs ) + rhs;
+	}
+	//--------------------------------------------------------------------------
+	std::string operator+( StringRef lhs, char const* rhs )
+	{
+		return lhs + StringRef( rhs );
+	}
+	//--------------------------------------------------------------------------
+	std::string& operator+=( std::string& lhs, StringRef rhs )
+	{
+		return lhs.append( rhs.data(), rhs.size() );
+	}
+	//--------------------------------------------------------------------------
+	std::ostream& operator<<( std::ostream& os, StringRef value )
+	{
+		return os.write( value.data(), value.size() );
+	}
+}
@@ -0,0 +1,120 @@
+// Copyright(c) 2015-2016, NVIDIA CORPORATION. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#ifndef VKSTRINGREF_H
+#define VKSTRINGREF_H
+
+#include <cstring>
+#include <iosfwd>
+#include <string>
+
+namespace vk
+{
+	/**
+	 * @brief non-owning view of a character range, typically text held by the
+	 * parsed registry document. It must not outlive the characters it refers to.
+	 */
+	class StringRef
+	{
+	public:
+		static const size_t npos = std::string::npos;
+
+		StringRef()
+			: _data( "" ),
+			_size( 0 )
+		{}
+
+		StringRef( char const* value )
+			: _data( value ? value : "" ),
+			_size( value ? strlen( value ) : 0 )
+		{}
+
+		StringRef( char const* data, size_t size )
+			: _data( data ),
+			_size( size )
+		{}
+
+		StringRef( std::string const& value )
+			: _data( value.data() ),
+			_size( value.size() )
+		{}
+
+		char const* data() const { return _data; }
+		size_t size() const { return _size; }
+		size_t length() const { return _size; }
+		bool empty() const { return _size == 0; }
+
+		char const* begin() const { return _data; }
+		char const* end() const { return _data + _size; }
+
+		char operator[]( size_t index ) const { return _data[ index ]; }
+		char front() const { return _data[ 0 ]; }
+		char back() const { return _data[ _size - 1 ]; }
+
+		size_t find( char c, size_t pos = 0 ) const;
+		size_t find( StringRef value, size_t pos = 0 ) const;
+		size_t rfind( StringRef value ) const;
+
+		StringRef substr( size_t pos, size_t count = npos ) const;
+
+		int compare( StringRef rhs ) const;
+
+		/**
+		 * @brief materialize the view; only derived names should need this.
+		 */
+		std::string str() const { return std::string( _data, _size ); }
+		operator std::string() const { return str(); }
+
+	private:
+		char const*	_data;
+		size_t		_size;
+	};
+
+	inline bool operator==( StringRef lhs, StringRef rhs )
+	{
+		return lhs.size() == rhs.size() && memcmp( lhs.data(), rhs.data(), lhs.size() ) == 0;
+	}
+
+	inline bool operator!=( StringRef lhs, StringRef rhs ) { return !( lhs == rhs ); }
+	inline bool operator==( StringRef lhs, char const* rhs ) { return lhs == StringRef( rhs ); }
+	inline bool operator!=( StringRef lhs, char const* rhs ) { return !( lhs == StringRef( rhs ) ); }
+	inline bool operator<( StringRef lhs, StringRef rhs ) { return lhs.compare( rhs ) < 0; }
+
+	// the std::string operators are templates, they don't see the conversions above
+	inline bool operator==( std::string const& lhs, StringRef rhs ) { return StringRef( lhs ) == rhs; }
+	inline bool operator==( StringRef lhs, std::string const& rhs ) { return lhs == StringRef( rhs ); }
+	inline bool operator!=( std::string const& lhs, StringRef rhs ) { return !( lhs == rhs ); }
+	inline bool operator!=( StringRef lhs, std::string const& rhs ) { return !( lhs == rhs ); }
+
+	std::string operator+( StringRef lhs, StringRef rhs );
+	std::string operator+( std::string const& lhs, StringRef rhs );
+	std::string operator+( StringRef lhs, std::string const& rhs );
+	std::string operator+( char const* lhs, StringRef rhs );
+	std::string operator+( StringRef lhs, char const* rhs );
+	std::string& operator+=( std::string& lhs, StringRef rhs );
+
+	std::ostream& operator<<( std::ostream& os, StringRef value );
+}
+#endif // VKSTRINGREF_H
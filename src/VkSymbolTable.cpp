@@ -0,0 +1,60 @@
+// Copyright(c) 2015-2016, NVIDIA CORPORATION. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "VkSymbolTable.h"
+#include <algorithm>
+
+namespace vk
+{
+	const SymbolTable::Id SymbolTable::invalid;
+	//--------------------------------------------------------------------------
+	SymbolTable::Id SymbolTable::intern( std::string const& name )
+	{
+		auto it = _ids.insert( std::make_pair( name, static_cast<Id>( _names.size() ) ) ).first;
+		if( it->second == _names.size() )
+			_names.push_back( &it->first );
+
+		return it->second;
+	}
+	//--------------------------------------------------------------------------
+	SymbolTable::Id SymbolTable::find( std::string const& name ) const
+	{
+		auto it = _ids.find( name );
+		return it != _ids.end() ? it->second : invalid;
+	}
+	//--------------------------------------------------------------------------
+	//--------------------------------------------------------------------------
+	void SymbolSet::insert( SymbolTable::Id id )
+	{
+		auto it = std::lower_bound( _ids.begin(), _ids.end(), id );
+		if( it == _ids.end() || *it != id )
+			_ids.insert( it, id );
+	}
+	//--------------------------------------------------------------------------
+	bool SymbolSet::contains( SymbolTable::Id id ) const
+	{
+		return std::binary_search( _ids.begin(), _ids.end(), id );
+	}
+}
@@ -0,0 +1,186 @@
+// Copyright(c) 2015-2016, NVIDIA CORPORATION. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#ifndef VKSYMBOLTABLE_H
+#define VKSYMBOLTABLE_H
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <utility>
+#include <cstdint>
+#include "VkArena.h"
+
+namespace vk
+{
+	/**
+	 * @brief assigns each name a dense 32-bit id. Names are stored once and
+	 * stay at the same address for the lifetime of the table.
+	 */
+	class SymbolTable
+	{
+	public:
+		typedef uint32_t Id;
+		static const Id invalid = ~Id( 0 );
+
+		Id intern( std::string const& name );
+
+		Id find( std::string const& name ) const;
+
+		std::string const& name( Id id ) const { return *_names[ id ]; }
+
+		size_t size() const { return _names.size(); }
+
+	private:
+		std::unordered_map<std::string, Id>	_ids;
+		std::vector<std::string const*>		_names;
+	};
+
+	/**
+	 * @brief a sorted set of symbol ids.
+	 */
+	class SymbolSet
+	{
+	public:
+		typedef std::vector<SymbolTable::Id, ArenaAllocator<SymbolTable::Id>>::const_iterator const_iterator;
+
+		SymbolSet( SymbolTable& symbols, Arena& arena )
+			: _symbols( &symbols ),
+			_ids( arena )
+		{}
+
+		void insert( std::string const& name ) { insert( _symbols->intern( name ) ); }
+
+		void insert( SymbolTable::Id id );
+
+		bool contains( SymbolTable::Id id ) const;
+
+		const_iterator begin() const { return _ids.begin(); }
+		const_iterator end() const { return _ids.end(); }
+
+		size_t size() const { return _ids.size(); }
+		bool empty() const { return _ids.empty(); }
+
+		/**
+		 * @brief name of the first symbol of the set. Mostly useful for sets
+		 * holding a single symbol.
+		 */
+		std::string const& front() const { return _symbols->name( _ids.front() ); }
+
+	private:
+		SymbolTable*												_symbols;
+		std::vector<SymbolTable::Id, ArenaAllocator<SymbolTable::Id>>	_ids;
+	};
+
+	/**
+	 * @brief name to T map backed by a shared SymbolTable.
+	 *
+	 * The values are stored contiguously in insertion order and reached through
+	 * a table indexed by symbol id. The interface mimics the subset of std::map
+	 * used by the parser and the generator; like std::vector, inserting
+	 * invalidates iterators.
+	 */
+	template<typename T>
+	class SymbolMap
+	{
+	public:
+		struct value_type
+		{
+			value_type( std::string const& n, T const& v )
+				: first( n ),
+				second( v )
+			{}
+
+			std::string const&	first;
+			T					second;
+		};
+
+		typedef typename std::vector<value_type>::iterator iterator;
+		typedef typename std::vector<value_type>::const_iterator const_iterator;
+
+		explicit SymbolMap( SymbolTable& symbols )
+			: _symbols( &symbols )
+		{}
+
+		iterator begin() { return _values.begin(); }
+		iterator end() { return _values.end(); }
+		const_iterator begin() const { return _values.begin(); }
+		const_iterator end() const { return _values.end(); }
+
+		size_t size() const { return _values.size(); }
+		bool empty() const { return _values.empty(); }
+
+		iterator find( SymbolTable::Id id )
+		{
+			return _values.begin() + _slot( id );
+		}
+
+		const_iterator find( SymbolTable::Id id ) const
+		{
+			return _values.begin() + _slot( id );
+		}
+
+		iterator find( std::string const& name )
+		{
+			return find( _symbols->find( name ) );
+		}
+
+		const_iterator find( std::string const& name ) const
+		{
+			return find( _symbols->find( name ) );
+		}
+
+		std::pair<iterator, bool> insert( std::pair<std::string, T> const& value )
+		{
+			SymbolTable::Id id = _symbols->intern( value.first );
+			size_t slot = _slot( id );
+			if( slot != _values.size() )
+				return std::make_pair( _values.begin() + slot, false );
+
+			if( _slots.size() <= id )
+				_slots.resize( _symbols->size(), ~uint32_t( 0 ) );
+
+			_slots[ id ] = static_cast<uint32_t>( _values.size() );
+			_values.push_back( value_type( _symbols->name( id ), value.second ) );
+			return std::make_pair( _values.end() - 1, true );
+		}
+
+		T& operator[]( std::string const& name )
+		{
+			return insert( std::make_pair( name, T() ) ).first->second;
+		}
+
+	private:
+		size_t _slot( SymbolTable::Id id ) const
+		{
+			return ( id < _slots.size() && _slots[ id ] != ~uint32_t( 0 ) ) ? _slots[ id ] : _values.size();
+		}
+
+		SymbolTable*			_symbols;
+		std::vector<uint32_t>	_slots;
+		std::vector<value_type>	_values;
+	};
+}
+#endif // VKSYMBOLTABLE_H
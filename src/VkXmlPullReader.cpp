@@ -0,0 +1,169 @@
+// Copyright(c) 2015-2016, NVIDIA CORPORATION. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include "VkXmlPullReader.h"
+#include <cassert>
+#include <cctype>
+#include <cstring>
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
+namespace vk
+{
+	XmlPullReader::XmlPullReader( char const* begin, char const* end )
+		: _begin( begin ),
+		_current( begin ),
+		_end( end ),
+		_tokenBegin( begin ),
+		_tokenEnd( begin )
+	{}
+	//--------------------------------------------------------------------------
+	XmlPullReader::Event XmlPullReader::next()
+	{
+		if( _pendingEnd )
+		{
+			// second half of an empty element, reported on the same characters
+			_pendingEnd = false;
+			_depth--;
+			return Event::END_ELEMENT;
+		}
+
+		for( ;; )
+		{
+			_tokenBegin = _current;
+			if( _current == _end )
+			{
+				_tokenEnd = _current;
+				return Event::END_OF_INPUT;
+			}
+
+			if( *_current != '<' )
+			{
+				_current = std::find( _current, _end, '<' );
+				_tokenEnd = _current;
+				return Event::TEXT;
+			}
+
+			StringRef rest( _current, _end - _current );
+			if( rest.substr( 0, 4 ) == "<!--" )
+				_skipPast( "-->" );
+
+			else if( rest.substr( 0, 9 ) == "<![CDATA[" )
+			{
+				_skipPast( "]]>" );
+				_tokenEnd = _current;
+				return Event::TEXT;
+			}
+			else if( rest.substr( 0, 2 ) == "<?" )
+				_skipPast( "?>" );
+
+			else if( rest.substr( 0, 2 ) == "<!" )
+				_skipPast( ">" );
+
+			else if( rest.substr( 0, 2 ) == "</" )
+			{
+				_readTag();
+				if( !_depth )
+					_fail( "unbalanced end tag" );
+
+				_depth--;
+				return Event::END_ELEMENT;
+			}
+			else
+			{
+				_readTag();
+				_depth++;
+				if( _tokenEnd[ -2 ] == '/' )
+					_pendingEnd = true;
+
+				return Event::START_ELEMENT;
+			}
+		}
+	}
+	//--------------------------------------------------------------------------
+	void XmlPullReader::skipElement()
+	{
+		size_t depth = _depth;
+		assert( depth );
+		while( _depth >= depth )
+		{
+			if( next() == Event::END_OF_INPUT )
+				_fail( "unterminated element" );
+		}
+	}
+	//--------------------------------------------------------------------------
+	void XmlPullReader::_skipPast( char const* terminator )
+	{
+		StringRef rest( _current, _end - _current );
+		size_t pos = rest.find( terminator );
+		if( pos == StringRef::npos )
+			_fail( "unterminated markup" );
+
+		_current += pos + strlen( terminator );
+	}
+	//--------------------------------------------------------------------------
+	void XmlPullReader::_readTag()
+	{
+		char const* p = _current + ( _current[ 1 ] == '/' ? 2 : 1 );
+		char const* nameBegin = p;
+		while( p != _end && !isspace( static_cast<unsigned char>( *p ) ) && *p != '>' && *p != '/' )
+			p++;
+
+		if( p == nameBegin )
+			_fail( "missing element name" );
+
+		_name = StringRef( nameBegin, p - nameBegin );
+
+		// attribute values may contain '>', step over them as a whole
+		char quote = 0;
+		for( ; p != _end; p++ )
+		{
+			if( quote )
+			{
+				if( *p == quote )
+					quote = 0;
+			}
+			else if( *p == '"' || *p == '\'' )
+				quote = *p;
+
+			else if( *p == '>' )
+				break;
+		}
+
+		if( p == _end )
+			_fail( "unterminated tag" );
+
+		_current = p + 1;
+		_tokenEnd = _current;
+	}
+	//--------------------------------------------------------------------------
+	void XmlPullReader::_fail( char const* what ) const
+	{
+		std::stringstream ss;
+		ss << "XmlPullReader: " << what << " at offset " << ( _tokenBegin - _begin );
+		throw std::runtime_error( ss.str() );
+	}
+}
@@ -0,0 +1,98 @@
+// Copyright(c) 2015-2016, NVIDIA CORPORATION. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#ifndef VKXMLPULLREADER_H
+#define VKXMLPULLREADER_H
+
+#include "VkStringRef.h"
+
+namespace vk
+{
+	/**
+	 * @brief forward-only XML tokenizer working in place over a character range.
+	 *
+	 * Comments, processing instructions, doctype declarations and CDATA
+	 * sections are skipped. Attributes and entities are left untouched, the
+	 * reader only tracks element boundaries. An empty element <a/> is reported
+	 * as a START_ELEMENT immediately followed by its END_ELEMENT.
+	 * Malformed input makes next() throw a std::runtime_error.
+	 */
+	class XmlPullReader
+	{
+	public:
+		enum class Event
+		{
+			START_ELEMENT,
+			END_ELEMENT,
+			TEXT,
+			END_OF_INPUT
+		};
+
+		XmlPullReader( char const* begin, char const* end );
+
+		Event next();
+
+		/**
+		 * @brief after a START_ELEMENT, move to its matching END_ELEMENT.
+		 */
+		void skipElement();
+
+		/**
+		 * @brief name of the current element, for START_ELEMENT and END_ELEMENT.
+		 */
+		StringRef name() const { return _name; }
+
+		/**
+		 * @brief raw character data of the current TEXT event.
+		 */
+		StringRef text() const { return StringRef( _tokenBegin, _tokenEnd - _tokenBegin ); }
+
+		/**
+		 * @brief the characters of the current token, markup included.
+		 */
+		char const* tokenBegin() const { return _tokenBegin; }
+		char const* tokenEnd() const { return _tokenEnd; }
+
+		/**
+		 * @brief number of elements open after the current event.
+		 */
+		size_t depth() const { return _depth; }
+
+	private:
+		void _skipPast( char const* terminator );
+		void _readTag();
+		[[noreturn]] void _fail( char const* what ) const;
+
+		char const*	_begin;
+		char const*	_current;
+		char const*	_end;
+		char const*	_tokenBegin;
+		char const*	_tokenEnd;
+		StringRef	_name;
+		size_t		_depth = 0;
+		bool		_pendingEnd = false;
+	};
+}
+#endif // VKXMLPULLREADER_H
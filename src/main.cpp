@@ -48,6 +48,12 @@ int main( int argc, char** argv )
 	cmd.add<unsigned short>( "spacesize", 'z', "Specify spaces size. Only used when indenting with spaces", false, 2 );
 	cmd.add<std::string>( "pch", 'p', "Specify a precompiled header to include in source file (Used if generating separate files). Default value is", false );
 	cmd.add( "separate", 'r', "Generate separate header and source files." );
+	cmd.add<unsigned>( "jobs", 'j', "Number of threads used to read the spec file and to render the output. Default value is", false, 1 );
+	cmd.add( "ifchanged", 'w', "Only replace the output files whose content changed, the others keep their timestamp." );
+	cmd.add( "mmap", 'm', "Map the spec file in memory and only build a DOM for the registry sections in use." );
+	cmd.add( "tables", 't', "Convert enums and flags to strings through sorted tables instead of switch statements." );
+	cmd.add( "constexpr", 'x', "Define the constructors and setters of structs, unions, handles and flags in the header, constexpr with C++14." );
+	cmd.add( "stateful", 'b', "Generate StatefulCommandBuffer, a dispatcher dropping the bind and set commands which repeat the state bound." );
 	cmd.add<std::string>( "srcext", 's', "Change the default source extension (Used if generating separate files). Default value is", false, ".cc" );
 	cmd.add( "version", 'v', "Print version and exit" );
 	cmd.add( "help", 'h', "Print this message and exit" );
@@ -92,6 +98,13 @@ int main( int argc, char** argv )
 		opt.cmdLine = ss.str();
 	}
 
+	opt.mappedInput = cmd.exist( "mmap" );
+	opt.threads = cmd.get<unsigned>( "jobs" );
+	opt.writeIfChanged = cmd.exist( "ifchanged" );
+	opt.stringTables = cmd.exist( "tables" );
+	opt.constexprTypes = cmd.exist( "constexpr" );
+	opt.statefulCommandBuffer = cmd.exist( "stateful" );
+
 	if( cmd.exist( "spaceindent" ) )
 	{
 		opt.indentChar = ' ';